@@ -193,6 +193,10 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	// Borrows up to `p_length` bytes from the current position without copying them, and advances the position.
+	// The view stays valid until the file is closed. Returns an empty span when unsupported (e.g. the file isn't
+	// memory mapped), in which case the position doesn't change and `get_buffer()` should be used instead.
+	virtual Span<const uint8_t> get_buffer_view(uint64_t p_length) const { return Span<const uint8_t>(); }
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
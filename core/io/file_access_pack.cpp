@@ -493,6 +493,31 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return to_read;
 }
 
+Span<const uint8_t> FileAccessPack::get_buffer_view(uint64_t p_length) const {
+	ERR_FAIL_COND_V_MSG(f.is_null(), Span<const uint8_t>(), "File must be opened before use.");
+
+	if (eof) {
+		return Span<const uint8_t>();
+	}
+
+	const uint64_t to_read = MIN(p_length, pf.size - MIN(pos, pf.size));
+	// Only succeeds if the pack itself can be borrowed from (e.g. not encrypted), in which case its position moves with ours.
+	Span<const uint8_t> view = f->get_buffer_view(to_read);
+	if (view.size() != to_read) {
+		if (!view.is_empty()) {
+			f->seek(off + pos);
+		}
+		return Span<const uint8_t>();
+	}
+
+	pos += to_read;
+	if (to_read < p_length) {
+		eof = true;
+	}
+
+	return view;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
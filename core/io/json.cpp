@@ -49,13 +49,91 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
-void JSON::_add_indent(String &r_result, const String &p_indent, int p_size) {
+// Collects stringify() output as UTF-8 and writes it to a file in chunks.
+class JSONFileWriter {
+	static constexpr uint32_t CHUNK_SIZE = 65536;
+
+	Ref<FileAccess> file;
+	LocalVector<uint8_t> buffer;
+
+	_FORCE_INLINE_ void _append(const uint8_t *p_data, uint32_t p_size) {
+		const uint32_t prev_size = buffer.size();
+		buffer.resize(prev_size + p_size);
+		memcpy(buffer.ptr() + prev_size, p_data, p_size);
+		if (buffer.size() >= CHUNK_SIZE) {
+			flush();
+		}
+	}
+
+public:
+	void flush() {
+		if (!buffer.is_empty()) {
+			file->store_buffer(buffer.ptr(), buffer.size());
+			buffer.clear();
+		}
+	}
+
+	JSONFileWriter &operator+=(char p_char) {
+		_append((const uint8_t *)&p_char, 1);
+		return *this;
+	}
+
+	JSONFileWriter &operator+=(const char *p_str) {
+		_append((const uint8_t *)p_str, strlen(p_str));
+		return *this;
+	}
+
+	JSONFileWriter &operator+=(const String &p_str) {
+		const CharString utf8 = p_str.utf8();
+		_append((const uint8_t *)utf8.get_data(), utf8.length());
+		return *this;
+	}
+
+	JSONFileWriter(const Ref<FileAccess> &p_file) :
+			file(p_file) {
+		buffer.reserve(CHUNK_SIZE);
+	}
+};
+
+static _FORCE_INLINE_ void _append_string_run(String &r_str, const char32_t *p_run, int p_len) {
+	r_str.append_utf32(Span(p_run, p_len));
+}
+
+static _FORCE_INLINE_ void _append_string_run(String &r_str, const uint8_t *p_run, int p_len) {
+	if (p_len >= 3 && p_run[0] == 0xef && p_run[1] == 0xbb && p_run[2] == 0xbf) {
+		// A leading U+FEFF would be dropped as a byte order mark by append_utf8().
+		r_str += char32_t(0xfeff);
+		p_run += 3;
+		p_len -= 3;
+	}
+	if (p_len > 0) {
+		r_str.append_utf8((const char *)p_run, p_len);
+	}
+}
+
+static _FORCE_INLINE_ double _parse_number(const char32_t *p_str, int &r_len) {
+	const char32_t *end;
+	const double number = String::to_float(p_str, &end);
+	r_len = end - p_str;
+	return number;
+}
+
+static _FORCE_INLINE_ double _parse_number(const uint8_t *p_str, int &r_len) {
+	const char *end;
+	const double number = String::to_float((const char *)p_str, &end);
+	r_len = end - (const char *)p_str;
+	return number;
+}
+
+template <typename T>
+void JSON::_add_indent(T &r_result, const String &p_indent, int p_size) {
 	for (int i = 0; i < p_size; i++) {
 		r_result += p_indent;
 	}
 }
 
-void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
+template <typename T>
+void JSON::_stringify(T &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
 	if (p_cur_indent > Variant::MAX_RECURSION_DEPTH) {
 		r_result += "...";
 		ERR_FAIL_MSG("JSON structure is too deep. Bailing.");
@@ -199,7 +277,8 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 	}
 }
 
-Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
+template <typename C>
+Error JSON::_get_token(const C *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
 	while (p_len > 0) {
 		switch (p_str[index]) {
 			case '\n': {
@@ -369,10 +448,16 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 						str += res;
 
 					} else {
-						if (p_str[index] == '\n') {
-							line++;
+						// Append everything up to the next quote or escape at once.
+						const int run_start = index;
+						while (p_str[index] != 0 && p_str[index] != '"' && p_str[index] != '\\') {
+							if (p_str[index] == '\n') {
+								line++;
+							}
+							index++;
 						}
-						str += p_str[index];
+						_append_string_run(str, p_str + run_start, index - run_start);
+						continue;
 					}
 					index++;
 				}
@@ -390,9 +475,9 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 
 				if (p_str[index] == '-' || is_digit(p_str[index])) {
 					//a number
-					const char32_t *rptr;
-					double number = String::to_float(&p_str[index], &rptr);
-					index += (rptr - &p_str[index]);
+					int number_len = 0;
+					double number = _parse_number(&p_str[index], number_len);
+					index += number_len;
 					r_token.type = TK_NUMBER;
 					r_token.value = number;
 					return OK;
@@ -420,7 +505,8 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C>
+Error JSON::_parse_value(Variant &value, Token &token, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
 	if (p_depth > Variant::MAX_RECURSION_DEPTH) {
 		r_err_str = "JSON structure is too deep";
 		return ERR_OUT_OF_MEMORY;
@@ -464,7 +550,8 @@ Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, in
 	return OK;
 }
 
-Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C>
+Error JSON::_parse_array(Array &array, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
 	Token token;
 	bool need_comma = false;
 
@@ -502,7 +589,8 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C>
+Error JSON::_parse_object(Dictionary &object, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
 	bool at_key = true;
 	String key;
 	Token token;
@@ -570,10 +658,11 @@ void JSON::set_data(const Variant &p_data) {
 	text.clear();
 }
 
-Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
-	const char32_t *str = p_json.ptr();
+template <typename C>
+Error JSON::_parse_text(const C *p_str, int p_len, Variant &r_ret, String &r_err_str, int &r_err_line) {
+	const C *str = p_str;
 	int idx = 0;
-	int len = p_json.length();
+	int len = p_len;
 	Token token;
 	r_err_line = 0;
 	String aux_key;
@@ -601,6 +690,10 @@ Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_st
 	return err;
 }
 
+Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
+	return _parse_text(p_json.ptr(), p_json.length(), r_ret, r_err_str, r_err_line);
+}
+
 Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	Error err = _parse_string(p_json_string, data, err_str, err_line);
 	if (err == Error::OK) {
@@ -612,6 +705,33 @@ Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	return err;
 }
 
+Error JSON::parse_file(const Ref<FileAccess> &p_file, bool p_keep_text) {
+	ERR_FAIL_COND_V(p_file.is_null(), ERR_INVALID_PARAMETER);
+	const uint64_t len = p_file->get_length() - p_file->get_position();
+	ERR_FAIL_COND_V_MSG(len >= (uint64_t)INT32_MAX, ERR_OUT_OF_MEMORY, "JSON file is too large to parse.");
+
+	// The tokenizer stops at a NUL character, so one is added at the end.
+	Vector<uint8_t> buffer;
+	buffer.resize_uninitialized(len + 1);
+	uint8_t *w = buffer.ptrw();
+	const uint64_t read = p_file->get_buffer(w, len);
+	w[read] = 0;
+
+	int offset = 0;
+	if (read >= 3 && w[0] == 0xef && w[1] == 0xbb && w[2] == 0xbf) {
+		offset = 3; // Skip the byte order mark, as String::utf8() does.
+	}
+
+	Error err = _parse_text(w + offset, read - offset, data, err_str, err_line);
+	if (err == Error::OK) {
+		err_line = 0;
+	}
+	if (p_keep_text) {
+		text = String::utf8((const char *)w, read);
+	}
+	return err;
+}
+
 String JSON::get_parsed_text() const {
 	return text;
 }
@@ -623,6 +743,17 @@ String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort
 	return result;
 }
 
+Error JSON::stringify_to_file(const Ref<FileAccess> &p_file, const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
+	ERR_FAIL_COND_V(p_file.is_null(), ERR_INVALID_PARAMETER);
+	JSONFileWriter writer(p_file);
+	HashSet<const void *> markers;
+	_stringify(writer, p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	writer.flush();
+
+	const Error err = p_file->get_error();
+	return (err != OK && err != ERR_FILE_EOF) ? ERR_FILE_CANT_WRITE : OK;
+}
+
 Variant JSON::parse_string(const String &p_json_string) {
 	Ref<JSON> json;
 	json.instantiate();
@@ -1566,10 +1697,15 @@ Ref<Resource> ResourceFormatLoaderJSON::load(const String &p_path, const String
 		return Ref<Resource>();
 	}
 
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
+	if (file.is_null()) {
+		return Ref<Resource>();
+	}
+
 	Ref<JSON> json;
 	json.instantiate();
 
-	Error err = json->parse(FileAccess::get_file_as_string(p_path), Engine::get_singleton()->is_editor_hint());
+	Error err = json->parse_file(file, Engine::get_singleton()->is_editor_hint());
 	if (err != OK) {
 		String err_text = "Error parsing JSON file at '" + p_path + "', on line " + itos(json->get_error_line()) + ": " + json->get_error_message();
 
@@ -1611,14 +1747,17 @@ Error ResourceFormatSaverJSON::save(const Ref<Resource> &p_resource, const Strin
 	Ref<JSON> json = p_resource;
 	ERR_FAIL_COND_V(json.is_null(), ERR_INVALID_PARAMETER);
 
-	String source = json->get_parsed_text().is_empty() ? JSON::stringify(json->get_data(), "\t", false, true) : json->get_parsed_text();
-
 	Error err;
 	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE, &err);
 
 	ERR_FAIL_COND_V_MSG(err, err, vformat("Cannot save json '%s'.", p_path));
 
-	file->store_string(source);
+	if (json->get_parsed_text().is_empty()) {
+		// Large data is written out as it is generated.
+		JSON::stringify_to_file(file, json->get_data(), "\t", false, true);
+	} else {
+		file->store_string(json->get_parsed_text());
+	}
 	if (file->get_error() != OK && file->get_error() != ERR_FILE_EOF) {
 		return ERR_CANT_CREATE;
 	}
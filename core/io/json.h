@@ -35,6 +35,8 @@
 #include "core/io/resource_saver.h"
 #include "core/variant/variant.h"
 
+class FileAccess;
+
 class JSON : public Resource {
 	GDCLASS(JSON, Resource);
 
@@ -71,12 +73,22 @@ class JSON : public Resource {
 
 	static const char *tk_name[];
 
-	static void _add_indent(String &r_result, const String &p_indent, int p_size);
-	static void _stringify(String &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision);
-	static Error _get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
-	static Error _parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	// Output and input are templated on the character storage, so that files can be
+	// written and read as UTF-8 without going through a String holding the whole text.
+	template <typename T>
+	static void _add_indent(T &r_result, const String &p_indent, int p_size);
+	template <typename T>
+	static void _stringify(T &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision);
+	template <typename C>
+	static Error _get_token(const C *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
+	template <typename C>
+	static Error _parse_value(Variant &value, Token &token, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	template <typename C>
+	static Error _parse_array(Array &array, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	template <typename C>
+	static Error _parse_object(Dictionary &object, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	template <typename C>
+	static Error _parse_text(const C *p_str, int p_len, Variant &r_ret, String &r_err_str, int &r_err_line);
 	static Error _parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line);
 
 	static Variant _from_native(const Variant &p_variant, bool p_full_objects, int p_depth);
@@ -87,9 +99,13 @@ protected:
 
 public:
 	Error parse(const String &p_json_string, bool p_keep_text = false);
+	// Parses the rest of p_file as UTF-8, without decoding it into a String first.
+	Error parse_file(const Ref<FileAccess> &p_file, bool p_keep_text = false);
 	String get_parsed_text() const;
 
 	static String stringify(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
+	// Same output as stringify(), written to p_file as UTF-8 in chunks.
+	static Error stringify_to_file(const Ref<FileAccess> &p_file, const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
 	static Variant parse_string(const String &p_json_string);
 
 	_FORCE_INLINE_ static Variant from_native(const Variant &p_variant, bool p_full_objects = false) {
@@ -199,6 +199,8 @@ public:
 	};
 
 	static HashMap<StringName, ClassInfo> classes;
+	// Increased whenever classes are removed, which invalidates pointers returned by get_property_setget().
+	inline static SafeNumeric<uint32_t> property_setget_version{ 1 };
 	static HashMap<StringName, StringName> resource_base_extensions;
 	static HashMap<StringName, StringName> compat_classes;
 
@@ -245,6 +247,7 @@ private:
 	static Object *_instantiate_internal(const StringName &p_class, bool p_require_real_class = false, bool p_notify_postinitialize = true, bool p_exposed_only = true);
 
 	static bool _can_instantiate(ClassInfo *p_class_info, bool p_exposed_only = true);
+	static void _call_property_setter(Object *p_object, const PropertySetGet *p_setget, const Variant &p_value, bool *r_valid);
 
 public:
 	template <typename T>
@@ -483,6 +486,12 @@ public:
 	static Variant::Type get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
 	static StringName get_property_setter(const StringName &p_class, const StringName &p_property);
 	static StringName get_property_getter(const StringName &p_class, const StringName &p_property);
+	static const PropertySetGet *get_property_setget(const StringName &p_class, const StringName &p_property);
+	// Pointers returned by get_property_setget() stay valid as long as this doesn't change.
+	static uint32_t get_property_setget_version() { return property_setget_version.get(); }
+	// Same as Object::set() with the result of get_property_setget() for the object's class,
+	// when the object has no script or extension instance.
+	static void call_property_setter(Object *p_object, const PropertySetGet *p_setget, const Variant &p_value, bool *r_valid = nullptr);
 
 	static bool has_method(const StringName &p_class, const StringName &p_method, bool p_no_inheritance = false);
 	static void set_method_flags(const StringName &p_class, const StringName &p_method, int p_flags);
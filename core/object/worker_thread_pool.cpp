@@ -52,14 +52,26 @@ WorkerThreadPool *WorkerThreadPool::singleton = nullptr;
 
 #ifdef THREADS_ENABLED
 thread_local WorkerThreadPool::UnlockableLocks WorkerThreadPool::unlockable_locks[MAX_UNLOCKABLE_LOCKS];
+thread_local WorkerThreadPool::ThreadData *WorkerThreadPool::current_thread_data = nullptr;
 #endif
 
-void WorkerThreadPool::_process_task(Task *p_task) {
-#ifdef THREADS_ENABLED
-	int pool_thread_index = thread_ids[Thread::get_caller_id()];
-	ThreadData &curr_thread = threads[pool_thread_index];
-	Task *prev_task = nullptr; // In case this is recursively called.
+// Binds a task just taken from the queue to the pool thread that will run it.
+// Doing it while the queue is still locked saves another round trip on the task mutex per task.
+// Returns the task the thread was running before (in case this is recursively called), which
+// _process_task() restores afterwards.
+WorkerThreadPool::Task *WorkerThreadPool::_start_task(ThreadData *p_thread_data, Task *p_task) {
+	p_task->pool_thread_index = p_thread_data->index;
+	Task *prev_task = p_thread_data->current_task;
+	p_thread_data->current_task = p_task;
+	p_thread_data->has_pump_task = p_task->is_pump_task;
+	if (p_task->pending_notify_yield_over) {
+		p_thread_data->yield_is_over = true;
+	}
+	return prev_task;
+}
 
+void WorkerThreadPool::_process_task(Task *p_task, ThreadData *p_thread_data, Task *p_prev_task) {
+#ifdef THREADS_ENABLED
 	bool safe_for_nodes_backup = is_current_thread_safe_for_nodes();
 	CallQueue *call_queue_backup = MessageQueue::get_singleton() != MessageQueue::get_main_singleton() ? MessageQueue::get_singleton() : nullptr;
 
@@ -73,16 +85,6 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		// Therefore, we do it late at the first opportunity, so in case the task
 		// about to be run uses scripting, guarantees are held.
 		ScriptServer::thread_enter();
-
-		task_mutex.lock();
-		p_task->pool_thread_index = pool_thread_index;
-		prev_task = curr_thread.current_task;
-		curr_thread.current_task = p_task;
-		curr_thread.has_pump_task = p_task->is_pump_task;
-		if (p_task->pending_notify_yield_over) {
-			curr_thread.yield_is_over = true;
-		}
-		task_mutex.unlock();
 	}
 #endif
 
@@ -121,21 +123,23 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		}
 
 		if (do_post) {
+			{
+				MutexLock task_lock(task_mutex);
+				p_task->group->completed.set_to(true);
+				_release_dependents(p_task->group->dependents, p_thread_data);
+			}
 			p_task->group->done_semaphore.post();
-			p_task->group->completed.set_to(true);
 		}
 		uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = p_task->group->finished.increment();
 
+		task_mutex.lock();
 		if (finished_users == max_users) {
 			// Get rid of the group, because nobody else is using it.
-			MutexLock task_lock(task_mutex);
 			group_allocator.free(p_task->group);
 		}
 
 		// For groups, tasks get rid of themselves.
-
-		task_mutex.lock();
 		task_allocator.free(p_task);
 	} else {
 		if (p_task->native_func) {
@@ -150,6 +154,7 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		task_mutex.lock();
 		p_task->completed = true;
 		p_task->pool_thread_index = -1;
+		_release_dependents(p_task->dependents, p_thread_data);
 		if (p_task->waiting_user) {
 			p_task->done_semaphore.post(p_task->waiting_user);
 		}
@@ -164,13 +169,15 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 
 #ifdef THREADS_ENABLED
 	{
-		curr_thread.current_task = prev_task;
+		if (p_thread_data) {
+			p_thread_data->current_task = p_prev_task;
+		}
 		if (low_priority) {
 			low_priority_threads_used--;
 
 			if (_try_promote_low_priority_task()) {
-				if (prev_task) { // Otherwise, this thread will catch it.
-					_notify_threads(&curr_thread, 1, 0);
+				if (p_prev_task) { // Otherwise, this thread will catch it.
+					_notify_threads(p_thread_data, 1, 0);
 				}
 			}
 		}
@@ -186,9 +193,13 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 void WorkerThreadPool::_thread_function(void *p_user) {
 	ThreadData *thread_data = (ThreadData *)p_user;
 	Thread::set_name(vformat("WorkerThread %d", thread_data->index));
+#ifdef THREADS_ENABLED
+	current_thread_data = thread_data;
+#endif
 
 	while (true) {
 		Task *task_to_process = nullptr;
+		Task *prev_task = nullptr;
 		{
 			// Create the lock outside the inner loop so it isn't needlessly unlocked and relocked
 			//  when no task was found to process, and the loop is re-entered.
@@ -212,12 +223,13 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 				// Got a task to process! Remove it from the queue, then break into the task handling section.
 				task_to_process = thread_data->pool->task_queue.first()->self();
 				thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
+				prev_task = thread_data->pool->_start_task(thread_data, task_to_process);
 				break;
 			}
 		}
 
 		DEV_ASSERT(task_to_process);
-		thread_data->pool->_process_task(task_to_process);
+		thread_data->pool->_process_task(task_to_process, thread_data, prev_task);
 	}
 }
 
@@ -244,24 +256,80 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 	uint32_t to_process = 0;
 	uint32_t to_promote = 0;
 
-	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
+	ThreadData *caller_pool_thread = _get_caller_pool_thread();
 
 	for (uint32_t i = 0; i < p_count; i++) {
-		p_tasks[i]->low_priority = !p_high_priority;
-		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
-			task_queue.add_last(&p_tasks[i]->task_elem);
-			if (!p_high_priority) {
-				low_priority_threads_used++;
+		_enqueue_task(p_tasks[i], p_high_priority, to_process, to_promote);
+	}
+
+	_notify_threads(caller_pool_thread, to_process, to_promote);
+}
+
+void WorkerThreadPool::_enqueue_task(Task *p_task, bool p_high_priority, uint32_t &r_to_process, uint32_t &r_to_promote) {
+	p_task->low_priority = !p_high_priority;
+	if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
+		task_queue.add_last(&p_task->task_elem);
+		if (!p_high_priority) {
+			low_priority_threads_used++;
+		}
+		r_to_process++;
+	} else {
+		// Too many threads using low priority, must go to queue.
+		low_priority_task_queue.add_last(&p_task->task_elem);
+		r_to_promote++;
+	}
+}
+
+// Makes the task wait for the given tasks and groups to complete.
+// Returns how many of them are still pending, zero meaning the task can be posted right away.
+uint32_t WorkerThreadPool::_add_dependencies(Task *p_task, Span<TaskID> p_dependencies) {
+	for (const TaskID dependency : p_dependencies) {
+		ERR_CONTINUE_MSG(dependency < 1 || dependency >= (TaskID)last_task, vformat("Invalid task or group ID as dependency: %d.", dependency));
+
+		Task **taskp = tasks.getptr(dependency);
+		if (taskp) {
+			if (!(*taskp)->completed) {
+				(*taskp)->dependents.push_back(p_task);
+				p_task->pending_dependencies++;
 			}
-			to_process++;
-		} else {
-			// Too many threads using low priority, must go to queue.
-			low_priority_task_queue.add_last(&p_tasks[i]->task_elem);
-			to_promote++;
+			continue;
+		}
+
+		Group **groupp = groups.getptr(dependency);
+		if (groupp && !(*groupp)->completed.is_set()) {
+			(*groupp)->dependents.push_back(p_task);
+			p_task->pending_dependencies++;
 		}
+
+		// Otherwise, the dependency has already completed and been awaited.
 	}
+	return p_task->pending_dependencies;
+}
 
-	_notify_threads(caller_pool_thread, to_process, to_promote);
+// Posts the tasks whose last pending dependency has just completed.
+void WorkerThreadPool::_release_dependents(LocalVector<Task *> &p_dependents, const ThreadData *p_current_thread_data) {
+	if (p_dependents.is_empty()) {
+		return;
+	}
+
+	uint32_t to_process = 0;
+	uint32_t to_promote = 0;
+
+	for (Task *dependent : p_dependents) {
+		DEV_ASSERT(dependent->pending_dependencies > 0);
+		dependent->pending_dependencies--;
+		if (dependent->pending_dependencies == 0) {
+			if (unlikely(runlevel == RUNLEVEL_EXIT_LANGUAGES)) {
+				// Like posting, which waits for this runlevel to be over.
+				held_dependents.push_back(dependent);
+			} else {
+				_enqueue_task(dependent, !dependent->low_priority, to_process, to_promote);
+			}
+		}
+	}
+	p_dependents.clear();
+
+	_notify_threads(p_current_thread_data, to_process, to_promote);
 }
 
 void WorkerThreadPool::_notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count) {
@@ -344,7 +412,11 @@ WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *
 	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, bool p_pump_task) {
+WorkerThreadPool::TaskID WorkerThreadPool::add_native_task_after(Span<TaskID> p_dependencies, void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description) {
+	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description, false, p_dependencies);
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, bool p_pump_task, Span<TaskID> p_dependencies) {
 	MutexLock<BinaryMutex> lock(task_mutex);
 
 	// Get a free task
@@ -372,11 +444,16 @@ WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable,
 			threads[thread_count].index = thread_count;
 			threads[thread_count].pool = this;
 			threads[thread_count].thread.start(&WorkerThreadPool::_thread_function, &threads[thread_count]);
-			thread_ids.insert(threads[thread_count].thread.get_id(), thread_count);
 		}
 	}
 #endif
 
+	if (_add_dependencies(task, p_dependencies)) {
+		// Remember the priority for when the last dependency completes.
+		task->low_priority = !p_high_priority;
+		return id;
+	}
+
 	_post_tasks(&task, 1, p_high_priority, lock, p_pump_task);
 
 	return id;
@@ -390,6 +467,10 @@ WorkerThreadPool::TaskID WorkerThreadPool::add_task_bind(const Callable &p_actio
 	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, false);
 }
 
+WorkerThreadPool::TaskID WorkerThreadPool::add_task_after(Span<TaskID> p_dependencies, const Callable &p_action, bool p_high_priority, const String &p_description) {
+	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, false, p_dependencies);
+}
+
 bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
 	MutexLock task_lock(task_mutex);
 	const Task *const *taskp = tasks.getptr(p_task_id);
@@ -418,7 +499,7 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 		return OK;
 	}
 
-	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
+	ThreadData *caller_pool_thread = _get_caller_pool_thread();
 	if (caller_pool_thread && p_task_id <= caller_pool_thread->current_task->self) {
 		// Deadlock prevention:
 		// When a pool thread wants to wait for an older task, the following situations can happen:
@@ -490,6 +571,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 
 	while (true) {
 		Task *task_to_process = nullptr;
+		Task *prev_task = nullptr;
 		bool relock_unlockables = false;
 		{
 			MutexLock lock(task_mutex);
@@ -543,6 +625,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 					_notify_threads(p_caller_pool_thread, 1, 0);
 				} else {
 					task_queue.remove(task_queue.first());
+					prev_task = _start_task(p_caller_pool_thread, task_to_process);
 				}
 			}
 
@@ -565,7 +648,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 		}
 
 		if (task_to_process) {
-			_process_task(task_to_process);
+			_process_task(task_to_process, p_caller_pool_thread, prev_task);
 		}
 	}
 }
@@ -574,6 +657,15 @@ void WorkerThreadPool::_switch_runlevel(Runlevel p_runlevel) {
 	DEV_ASSERT(p_runlevel > runlevel);
 	runlevel = p_runlevel;
 	memset(&runlevel_data, 0, sizeof(runlevel_data));
+	if (!held_dependents.is_empty() && runlevel != RUNLEVEL_EXIT_LANGUAGES) {
+		// All threads are notified below.
+		uint32_t to_process = 0;
+		uint32_t to_promote = 0;
+		for (Task *dependent : held_dependents) {
+			_enqueue_task(dependent, !dependent->low_priority, to_process, to_promote);
+		}
+		held_dependents.clear();
+	}
 	for (uint32_t i = 0; i < threads.size(); i++) {
 		threads[i].cond_var.notify_one();
 		threads[i].signaled = true;
@@ -652,7 +744,7 @@ void WorkerThreadPool::notify_yield_over(TaskID p_task_id) {
 	td.cond_var.notify_one();
 }
 
-WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, Span<TaskID> p_dependencies) {
 	ERR_FAIL_COND_V(p_elements < 0, INVALID_TASK_ID);
 	if (p_tasks < 0) {
 		p_tasks = MAX(1u, threads.size());
@@ -694,6 +786,20 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 
 	groups[id] = group;
 
+	if (p_tasks > 0 && !p_dependencies.is_empty()) {
+		// All the tasks of the group share the same dependencies, so they will be released together.
+		bool pending = false;
+		for (int i = 0; i < p_tasks; i++) {
+			if (_add_dependencies(tasks_posted[i], p_dependencies)) {
+				tasks_posted[i]->low_priority = !p_high_priority;
+				pending = true;
+			}
+		}
+		if (pending) {
+			return id;
+		}
+	}
+
 	_post_tasks(tasks_posted, p_tasks, p_high_priority, lock, false);
 
 	return id;
@@ -707,6 +813,14 @@ WorkerThreadPool::GroupID WorkerThreadPool::add_group_task(const Callable &p_act
 	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description);
 }
 
+WorkerThreadPool::GroupID WorkerThreadPool::add_native_group_task_after(Span<TaskID> p_dependencies, void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(Callable(), p_func, p_userdata, nullptr, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
+}
+
+WorkerThreadPool::GroupID WorkerThreadPool::add_group_task_after(Span<TaskID> p_dependencies, const Callable &p_action, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
+}
+
 uint32_t WorkerThreadPool::get_group_processed_element_count(GroupID p_group) const {
 	MutexLock task_lock(task_mutex);
 	const Group *const *groupp = groups.getptr(p_group);
@@ -744,6 +858,12 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 			_lock_unlockable_mutexes();
 		}
 
+		{
+			// Unregister the group before it may be freed, so it can't be looked up as a dependency anymore.
+			MutexLock task_lock(task_mutex); // This mutex is needed when Physics 2D and/or 3D is selected to run on a separate thread.
+			groups.erase(p_group);
+		}
+
 		uint32_t max_users = group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = group->finished.increment(); // fetch happens before inc, so increment later.
 
@@ -753,15 +873,12 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 			group_allocator.free(group);
 		}
 	}
-
-	MutexLock task_lock(task_mutex); // This mutex is needed when Physics 2D and/or 3D is selected to run on a separate thread.
-	groups.erase(p_group);
 #endif
 }
 
 int WorkerThreadPool::get_thread_index() const {
-	Thread::ID tid = Thread::get_caller_id();
-	return thread_ids.has(tid) ? thread_ids[tid] : -1;
+	const ThreadData *caller_pool_thread = _get_caller_pool_thread();
+	return caller_pool_thread ? (int)caller_pool_thread->index : -1;
 }
 
 WorkerThreadPool::TaskID WorkerThreadPool::get_caller_task_id() const {
@@ -832,7 +949,6 @@ void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio)
 		threads[i].index = i;
 		threads[i].pool = this;
 		threads[i].thread.start(&WorkerThreadPool::_thread_function, &threads[i]);
-		thread_ids.insert(threads[i].thread.get_id(), i);
 	}
 }
 
@@ -40,6 +40,7 @@
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
+#include "core/templates/span.h"
 #include "core/variant/callable.h"
 
 class WorkerThreadPool : public Object {
@@ -70,6 +71,7 @@ private:
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
+		LocalVector<Task *> dependents; // Queued once the group completes.
 	};
 
 	struct Task {
@@ -90,6 +92,8 @@ private:
 		bool low_priority = false;
 		BaseTemplateUserdata *template_userdata = nullptr;
 		int pool_thread_index = -1;
+		uint32_t pending_dependencies = 0; // While nonzero, the task is held back from the queues.
+		LocalVector<Task *> dependents; // Queued once this task completes.
 
 		void free_template_userdata();
 		Task() :
@@ -149,8 +153,9 @@ private:
 		} exit_languages;
 	} runlevel_data;
 	ConditionVariable control_cond_var;
+	// Dependents released while threads detach from scripting languages, queued once that's over.
+	LocalVector<Task *> held_dependents;
 
-	HashMap<Thread::ID, int> thread_ids;
 	HashMap<
 			TaskID,
 			Task *,
@@ -177,9 +182,13 @@ private:
 
 	static void _thread_function(void *p_user);
 
-	void _process_task(Task *task);
+	Task *_start_task(ThreadData *p_thread_data, Task *p_task);
+	void _process_task(Task *p_task, ThreadData *p_thread_data = nullptr, Task *p_prev_task = nullptr);
 
 	void _post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority, MutexLock<BinaryMutex> &p_lock, bool p_pump_task);
+	void _enqueue_task(Task *p_task, bool p_high_priority, uint32_t &r_to_process, uint32_t &r_to_promote);
+	uint32_t _add_dependencies(Task *p_task, Span<TaskID> p_dependencies);
+	void _release_dependents(LocalVector<Task *> &p_dependents, const ThreadData *p_current_thread_data);
 	void _notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count);
 
 	bool _try_promote_low_priority_task();
@@ -193,10 +202,21 @@ private:
 		uint32_t rc = 0;
 	};
 	static thread_local UnlockableLocks unlockable_locks[MAX_UNLOCKABLE_LOCKS];
+
+	// Set once by each pool thread on startup, so finding the caller's ThreadData never needs the task mutex.
+	static thread_local ThreadData *current_thread_data;
+#endif
+
+	_FORCE_INLINE_ ThreadData *_get_caller_pool_thread() const {
+#ifdef THREADS_ENABLED
+		return (current_thread_data && current_thread_data->pool == this) ? current_thread_data : nullptr;
+#else
+		return nullptr;
 #endif
+	}
 
-	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, bool p_pump_task = false);
-	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
+	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, bool p_pump_task = false, Span<TaskID> p_dependencies = Span<TaskID>());
+	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, Span<TaskID> p_dependencies = Span<TaskID>());
 
 	template <typename C, typename M, typename U>
 	struct TaskUserData : public BaseTemplateUserdata {
@@ -247,6 +267,22 @@ public:
 	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String(), bool p_pump_task = false);
 	TaskID add_task_bind(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
 
+	// The `_after` variants take the IDs of tasks and groups that must complete first.
+	// The new task is only queued once all of them are done, so nobody has to block waiting for them.
+	// IDs of work that has already completed (even if already awaited) are accepted and ignored.
+	// The returned ID must still be awaited as usual.
+	template <typename C, typename M, typename U>
+	TaskID add_template_task_after(Span<TaskID> p_dependencies, C *p_instance, M p_method, U p_userdata, bool p_high_priority = false, const String &p_description = String()) {
+		typedef TaskUserData<C, M, U> TUD;
+		TUD *ud = memnew(TUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description, false, p_dependencies);
+	}
+	TaskID add_native_task_after(Span<TaskID> p_dependencies, void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String());
+	TaskID add_task_after(Span<TaskID> p_dependencies, const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
+
 	bool is_task_completed(TaskID p_task_id) const;
 	Error wait_for_task_completion(TaskID p_task_id);
 
@@ -264,6 +300,18 @@ public:
 	}
 	GroupID add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	GroupID add_group_task(const Callable &p_action, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+
+	template <typename C, typename M, typename U>
+	GroupID add_template_group_task_after(Span<TaskID> p_dependencies, C *p_instance, M p_method, U p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String()) {
+		typedef GroupUserData<C, M, U> GroupUD;
+		GroupUD *ud = memnew(GroupUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_group_task(Callable(), nullptr, nullptr, ud, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
+	}
+	GroupID add_native_group_task_after(Span<TaskID> p_dependencies, void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+	GroupID add_group_task_after(Span<TaskID> p_dependencies, const Callable &p_action, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	uint32_t get_group_processed_element_count(GroupID p_group) const;
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
@@ -81,6 +81,11 @@ public:
 		return const_cast<THREADING_NAMESPACE::unique_lock<THREADING_NAMESPACE::mutex> &>(tls_data.lock);
 	}
 
+	// Whether the calling thread currently holds the lock, at any recursion level.
+	_ALWAYS_INLINE_ bool is_locked_by_current_thread() const {
+		return tls_data.count > 0;
+	}
+
 	_ALWAYS_INLINE_ SafeBinaryMutex() {
 	}
 
@@ -130,6 +135,7 @@ class SafeBinaryMutex {
 public:
 	void lock() const {}
 	void unlock() const {}
+	bool is_locked_by_current_thread() const { return false; }
 };
 
 template <int Tag>
@@ -75,6 +75,94 @@ static bool strings_equal_lower(const T1 *p_lhs_begin, const T2 *p_rhs_begin, si
 	return true;
 }
 
+// Fast paths for transcoding and search work on fixed-size blocks. The inner loops are
+// branch-free so the compiler can vectorize them for the target (SSE2, NEON, ...), and
+// the per-character code only runs where a block contains something to handle.
+static constexpr int STRING_SCAN_BLOCK = 16;
+
+// Length of the leading whole blocks that only contain non-NUL ASCII bytes.
+static _FORCE_INLINE_ int _ascii_block_prefix(const uint8_t *p_str, int p_len) {
+	int i = 0;
+	for (; i + STRING_SCAN_BLOCK <= p_len; i += STRING_SCAN_BLOCK) {
+		bool stop = false;
+		for (int j = 0; j < STRING_SCAN_BLOCK; j++) {
+			stop |= uint32_t(p_str[i + j] - 1u) >= 0x7fu; // NUL wraps around.
+		}
+		if (stop) {
+			break;
+		}
+	}
+	return i;
+}
+
+// Length of the leading whole blocks that only contain characters below p_limit.
+static _FORCE_INLINE_ int _char32_block_prefix_below(const char32_t *p_str, int p_len, char32_t p_limit) {
+	int i = 0;
+	for (; i + STRING_SCAN_BLOCK <= p_len; i += STRING_SCAN_BLOCK) {
+		bool stop = false;
+		for (int j = 0; j < STRING_SCAN_BLOCK; j++) {
+			stop |= p_str[i + j] >= p_limit;
+		}
+		if (stop) {
+			break;
+		}
+	}
+	return i;
+}
+
+// Length of the leading whole blocks of UTF-16 units that are neither NUL nor surrogates.
+static _FORCE_INLINE_ int _utf16_plain_block_prefix(const char16_t *p_str, int p_len, bool p_byteswap) {
+	int i = 0;
+	for (; i + STRING_SCAN_BLOCK <= p_len; i += STRING_SCAN_BLOCK) {
+		bool stop = false;
+		for (int j = 0; j < STRING_SCAN_BLOCK; j++) {
+			const uint16_t c = p_byteswap ? BSWAP16(uint16_t(p_str[i + j])) : uint16_t(p_str[i + j]);
+			stop |= (c == 0) | ((c & 0xf800) == 0xd800);
+		}
+		if (stop) {
+			break;
+		}
+	}
+	return i;
+}
+
+static int _find_char32(const char32_t *p_str, int p_len, int p_from, char32_t p_char) {
+	int i = p_from;
+	for (; i + STRING_SCAN_BLOCK <= p_len; i += STRING_SCAN_BLOCK) {
+		bool found = false;
+		for (int j = 0; j < STRING_SCAN_BLOCK; j++) {
+			found |= p_str[i + j] == p_char;
+		}
+		if (found) {
+			break;
+		}
+	}
+	for (; i < p_len; i++) {
+		if (p_str[i] == p_char) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+// Finds candidates with _find_char32() on the first character, then compares the rest.
+template <typename T>
+static int _find_sequence(const char32_t *p_str, int p_len, int p_from, const T *p_seq, int p_seq_len) {
+	const char32_t first = p_seq[0];
+	const int candidates_len = p_len - p_seq_len + 1;
+	int i = p_from;
+	while (true) {
+		i = _find_char32(p_str, candidates_len, i, first);
+		if (i < 0) {
+			return -1;
+		}
+		if (are_spans_equal(p_str + i + 1, p_seq + 1, p_seq_len - 1)) {
+			return i;
+		}
+		i++;
+	}
+}
+
 Error String::parse_url(String &r_scheme, String &r_host, int &r_port, String &r_path, String &r_fragment) const {
 	// Splits the URL into scheme, host, port, path, fragment. Strip credentials when present.
 	String base = *this;
@@ -1772,6 +1860,16 @@ Error String::append_utf8(const char *p_utf8, int p_len) {
 		uint32_t size = 1;
 
 		if ((c & 0b10000000) == 0) {
+			const int ascii_run = _ascii_block_prefix(ptrtmp, ptr_limit - ptrtmp);
+			if (ascii_run > 0) {
+				for (int i = 0; i < ascii_run; i++) {
+					dst[i] = ptrtmp[i];
+				}
+				dst += ascii_run;
+				ptrtmp += ascii_run;
+				continue;
+			}
+
 			unicode = c;
 			if (unicode > 0x7F) {
 				unicode = _replacement_char;
@@ -1922,6 +2020,15 @@ CharString String::utf8(Vector<uint8_t> *r_ch_length_map) const {
 		uint32_t c = d[i];
 		int ch_w = 1;
 		if (c <= 0x7f) { // 7 bits.
+			const int ascii_run = _char32_block_prefix_below(d + i, l - i, 0x80);
+			if (ascii_run > 0) {
+				fl += ascii_run;
+				if (map_ptr) {
+					memset(map_ptr + i, 1, ascii_run);
+				}
+				i += ascii_run - 1;
+				continue;
+			}
 			ch_w = 1;
 		} else if (c <= 0x7ff) { // 11 bits
 			ch_w = 2;
@@ -1959,6 +2066,15 @@ CharString String::utf8(Vector<uint8_t> *r_ch_length_map) const {
 		uint32_t c = d[i];
 
 		if (c <= 0x7f) { // 7 bits.
+			const int ascii_run = _char32_block_prefix_below(d + i, l - i, 0x80);
+			if (ascii_run > 0) {
+				for (int j = 0; j < ascii_run; j++) {
+					cdst[j] = d[i + j];
+				}
+				cdst += ascii_run;
+				i += ascii_run - 1;
+				continue;
+			}
 			APPEND_CHAR(c);
 		} else if (c <= 0x7ff) { // 11 bits
 			APPEND_CHAR(uint32_t(0xc0 | ((c >> 6) & 0x1f))); // Top 5 bits.
@@ -2039,6 +2155,18 @@ Error String::append_utf16(const char16_t *p_utf16, int p_len, bool p_default_li
 		uint32_t c_prev = 0;
 		bool skip = false;
 		while (ptrtmp != ptrtmp_limit && *ptrtmp) {
+			if (ptrtmp_limit && !skip) {
+				// Units outside of surrogate pairs map one to one, no need to look at them individually.
+				const int plain_run = _utf16_plain_block_prefix(ptrtmp, ptrtmp_limit - ptrtmp, byteswap);
+				if (plain_run > 0) {
+					str_size += plain_run;
+					cstr_size += plain_run;
+					ptrtmp += plain_run;
+					c_prev = (byteswap) ? BSWAP16(*(ptrtmp - 1)) : *(ptrtmp - 1);
+					continue;
+				}
+			}
+
 			uint32_t c = (byteswap) ? BSWAP16(*ptrtmp) : *ptrtmp;
 
 			if ((c & 0xfffffc00) == 0xd800) { // lead surrogate
@@ -2084,6 +2212,20 @@ Error String::append_utf16(const char16_t *p_utf16, int p_len, bool p_default_li
 	bool skip = false;
 	uint32_t c_prev = 0;
 	while (cstr_size) {
+		if (!skip) {
+			const int plain_run = _utf16_plain_block_prefix(p_utf16, cstr_size, byteswap);
+			if (plain_run > 0) {
+				for (int i = 0; i < plain_run; i++) {
+					dst[i] = (byteswap) ? BSWAP16(uint16_t(p_utf16[i])) : uint16_t(p_utf16[i]);
+				}
+				dst += plain_run;
+				p_utf16 += plain_run;
+				cstr_size -= plain_run;
+				c_prev = (byteswap) ? BSWAP16(*(p_utf16 - 1)) : *(p_utf16 - 1);
+				continue;
+			}
+		}
+
 		uint32_t c = (byteswap) ? BSWAP16(*p_utf16) : *p_utf16;
 
 		if ((c & 0xfffffc00) == 0xd800) { // lead surrogate
@@ -2129,6 +2271,14 @@ Char16String String::utf16() const {
 	int fl = 0;
 	for (int i = 0; i < l; i++) {
 		uint32_t c = d[i];
+		if (c < 0xd800) {
+			const int bmp_run = _char32_block_prefix_below(d + i, l - i, 0xd800);
+			if (bmp_run > 0) {
+				fl += bmp_run;
+				i += bmp_run - 1;
+				continue;
+			}
+		}
 		if (c <= 0xffff) { // 16 bits.
 			fl += 1;
 			if ((c & 0xfffff800) == 0xd800) {
@@ -2155,6 +2305,17 @@ Char16String String::utf16() const {
 	for (int i = 0; i < l; i++) {
 		uint32_t c = d[i];
 
+		if (c < 0xd800) {
+			const int bmp_run = _char32_block_prefix_below(d + i, l - i, 0xd800);
+			if (bmp_run > 0) {
+				for (int j = 0; j < bmp_run; j++) {
+					cdst[j] = d[i + j];
+				}
+				cdst += bmp_run;
+				i += bmp_run - 1;
+				continue;
+			}
+		}
 		if (c <= 0xffff) { // 16 bits.
 			APPEND_CHAR(c);
 		} else if (c <= 0x10ffff) { // 32 bits.
@@ -2572,8 +2733,8 @@ done:
 #define READING_EXP 3
 #define READING_DONE 4
 
-double String::to_float(const char *p_str) {
-	return built_in_strtod<char>(p_str);
+double String::to_float(const char *p_str, const char **r_end) {
+	return built_in_strtod<char>(p_str, (char **)r_end);
 }
 
 double String::to_float(const char32_t *p_str, const char32_t **r_end) {
@@ -3034,10 +3195,10 @@ int String::find(const String &p_str, int p_from) const {
 
 	if (p_str.length() == 1) {
 		// Optimize with single-char implementation.
-		return span().find(p_str[0], p_from);
+		return _find_char32(ptr(), len, p_from, p_str[0]);
 	}
 
-	return span().find_sequence(p_str.span(), p_from);
+	return _find_sequence(ptr(), len, p_from, p_str.ptr(), str_len);
 }
 
 int String::find(const char *p_str, int p_from) const {
@@ -3055,7 +3216,7 @@ int String::find(const char *p_str, int p_from) const {
 		return find_char(*p_str, p_from); // Optimize with single-char find.
 	}
 
-	return span().find_sequence(Span((const unsigned char *)p_str, str_len), p_from);
+	return _find_sequence(ptr(), len, p_from, (const unsigned char *)p_str, str_len);
 }
 
 int String::find_char(char32_t p_char, int p_from) const {
@@ -3065,7 +3226,7 @@ int String::find_char(char32_t p_char, int p_from) const {
 	if (p_from < 0 || p_from >= length()) {
 		return -1;
 	}
-	return span().find(p_char, p_from);
+	return _find_char32(ptr(), length(), p_from, p_char);
 }
 
 int String::findmk(const Vector<String> &p_keys, int p_from, int *r_key) const {
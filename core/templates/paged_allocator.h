@@ -129,6 +129,18 @@ public:
 		}
 	}
 
+	// Number of elements currently handed out.
+	uint64_t get_used_count() const {
+		if constexpr (thread_safe) {
+			spin_lock.lock();
+		}
+		uint64_t result = uint64_t(pages_allocated) * page_size - allocs_available;
+		if constexpr (thread_safe) {
+			spin_lock.unlock();
+		}
+		return result;
+	}
+
 	bool is_configured() const {
 		if constexpr (thread_safe) {
 			spin_lock.lock();
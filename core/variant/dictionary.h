@@ -50,7 +50,8 @@ class Dictionary {
 	void _unref() const;
 
 public:
-	using ConstIterator = HashMap<Variant, Variant, HashMapHasherDefault, StringLikeVariantComparator>::ConstIterator;
+	using Map = HashMap<Variant, Variant, HashMapHasherDefault, StringLikeVariantComparator>;
+	using ConstIterator = Map::ConstIterator;
 
 	ConstIterator begin() const;
 	ConstIterator end() const;
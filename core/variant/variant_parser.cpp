@@ -37,12 +37,7 @@
 #include "core/object/script_language.h"
 #include "core/string/string_buffer.h"
 
-char32_t VariantParser::Stream::get_char() {
-	// is within buffer?
-	if (readahead_pointer < readahead_filled) {
-		return readahead_buffer[readahead_pointer++];
-	}
-
+char32_t VariantParser::Stream::_refill_and_get_char() {
 	// attempt to readahead
 	readahead_filled = _read_buffer(readahead_buffer, readahead_enabled ? READAHEAD_SIZE : 1);
 	if (readahead_filled) {
@@ -53,7 +48,7 @@ char32_t VariantParser::Stream::get_char() {
 		eof = true;
 		return 0;
 	}
-	return get_char();
+	return readahead_buffer[readahead_pointer++];
 }
 
 bool VariantParser::Stream::is_eof() const {
@@ -147,6 +142,24 @@ const char *VariantParser::tk_name[TK_MAX] = {
 	"ERROR"
 };
 
+// Characters of string tokens from UTF-8 streams are bytes, which are collected as they
+// are and decoded once when the token ends.
+static _FORCE_INLINE_ void _append_string_token_char(bool p_utf8, LocalVector<char> &r_utf8_str, String &r_str, char32_t p_char) {
+	if (!p_utf8) {
+		r_str += p_char;
+	} else if (likely(p_char != 0 && p_char <= 0xff)) {
+		r_utf8_str.push_back(char(p_char));
+	} else {
+		// Escaped characters that are not bytes get the same replacement as Latin-1 encoding gives them.
+		String tmp;
+		tmp += p_char;
+		const CharString replacement = tmp.ascii(true);
+		for (int i = 0; i < replacement.length(); i++) {
+			r_utf8_str.push_back(replacement[i]);
+		}
+	}
+}
+
 static double stor_fix(const String &p_str) {
 	if (p_str == "inf") {
 		return Math::INF;
@@ -275,6 +288,9 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 				[[fallthrough]];
 			}
 			case '"': {
+				const bool is_utf8 = p_stream->is_utf8();
+				LocalVector<char> &utf8_str = p_stream->utf8_token;
+				utf8_str.clear();
 				String str;
 				char32_t prev = 0;
 				while (true) {
@@ -378,7 +394,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 							r_token.type = TK_ERROR;
 							return ERR_PARSE_ERROR;
 						}
-						str += res;
+						_append_string_token_char(is_utf8, utf8_str, str, res);
 					} else {
 						if (prev != 0) {
 							r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
@@ -388,7 +404,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 						if (ch == '\n') {
 							line++;
 						}
-						str += ch;
+						_append_string_token_char(is_utf8, utf8_str, str, ch);
 					}
 				}
 				if (prev != 0) {
@@ -397,11 +413,8 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 					return ERR_PARSE_ERROR;
 				}
 
-				if (p_stream->is_utf8()) {
-					// Re-interpret the string we built as ascii.
-					CharString string_as_ascii = str.ascii(true);
-					str.clear();
-					str.append_utf8(string_as_ascii);
+				if (is_utf8 && !utf8_str.is_empty()) {
+					str.append_utf8(utf8_str.ptr(), utf8_str.size());
 				}
 				if (string_name) {
 					r_token.type = TK_STRING_NAME;
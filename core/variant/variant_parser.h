@@ -32,6 +32,7 @@
 
 #include "core/io/file_access.h"
 #include "core/io/resource.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/variant.h"
 
 class VariantParser {
@@ -44,6 +45,8 @@ public:
 		uint32_t readahead_filled = 0;
 		bool eof = false;
 
+		char32_t _refill_and_get_char();
+
 	protected:
 		bool readahead_enabled = true;
 		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) = 0;
@@ -52,7 +55,16 @@ public:
 	public:
 		char32_t saved = 0;
 
-		char32_t get_char();
+		// Scratch storage for the bytes of string tokens in UTF-8 streams, reused between tokens.
+		LocalVector<char> utf8_token;
+
+		_FORCE_INLINE_ char32_t get_char() {
+			// is within buffer?
+			if (likely(readahead_pointer < readahead_filled)) {
+				return readahead_buffer[readahead_pointer++];
+			}
+			return _refill_and_get_char();
+		}
 		virtual bool is_utf8() const = 0;
 		bool is_eof() const;
 
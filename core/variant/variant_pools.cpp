@@ -68,26 +68,84 @@ static PagedAllocator<VariantPools::BucketSmall, true> _bucket_small;
 static PagedAllocator<VariantPools::BucketMedium, true> _bucket_medium;
 static PagedAllocator<VariantPools::BucketLarge, true> _bucket_large;
 
+namespace VariantPools {
+// Each thread keeps a few freed elements of every bucket around, so that the churn of temporaries
+// (e.g. math in scripts) is served without taking the shared pool's lock.
+template <typename T>
+class ThreadCache {
+	static constexpr uint32_t CAPACITY = 64;
+
+	PagedAllocator<T, true> &pool;
+	T *elements[CAPACITY];
+	uint32_t count = 0;
+
+public:
+	_FORCE_INLINE_ T *alloc() {
+		if (count > 0) {
+			return elements[--count];
+		}
+		return pool.alloc();
+	}
+
+	_FORCE_INLINE_ void free(T *p_ptr) {
+		if (count < CAPACITY) {
+			elements[count++] = p_ptr;
+			return;
+		}
+		pool.free(p_ptr);
+	}
+
+	_FORCE_INLINE_ uint32_t get_count() const { return count; }
+
+	explicit ThreadCache(PagedAllocator<T, true> &p_pool) :
+			pool(p_pool) {}
+
+	~ThreadCache() {
+		// Hand cached elements back when the thread exits.
+		for (uint32_t i = 0; i < count; i++) {
+			pool.free(elements[i]);
+		}
+	}
+};
+} //namespace VariantPools
+
+static thread_local VariantPools::ThreadCache<VariantPools::BucketSmall> _thread_cache_small(_bucket_small);
+static thread_local VariantPools::ThreadCache<VariantPools::BucketMedium> _thread_cache_medium(_bucket_medium);
+static thread_local VariantPools::ThreadCache<VariantPools::BucketLarge> _thread_cache_large(_bucket_large);
+
 void *VariantPools::alloc_small() {
-	return _bucket_small.alloc();
+	return _thread_cache_small.alloc();
 }
 
 void *VariantPools::alloc_medium() {
-	return _bucket_medium.alloc();
+	return _thread_cache_medium.alloc();
 }
 
 void *VariantPools::alloc_large() {
-	return _bucket_large.alloc();
+	return _thread_cache_large.alloc();
 }
 
 void VariantPools::free_small(void *p_ptr) {
-	_bucket_small.free(static_cast<BucketSmall *>(p_ptr));
+	_thread_cache_small.free(static_cast<BucketSmall *>(p_ptr));
 }
 
 void VariantPools::free_medium(void *p_ptr) {
-	_bucket_medium.free(static_cast<BucketMedium *>(p_ptr));
+	_thread_cache_medium.free(static_cast<BucketMedium *>(p_ptr));
 }
 
 void VariantPools::free_large(void *p_ptr) {
-	_bucket_large.free(static_cast<BucketLarge *>(p_ptr));
+	_thread_cache_large.free(static_cast<BucketLarge *>(p_ptr));
+}
+
+uint64_t VariantPools::get_used_memory(BucketType p_bucket) {
+	// Elements sitting in thread caches count as used here; only the calling thread's cache can be discounted.
+	switch (p_bucket) {
+		case BUCKET_TYPE_SMALL:
+			return (_bucket_small.get_used_count() - _thread_cache_small.get_count()) * sizeof(BucketSmall);
+		case BUCKET_TYPE_MEDIUM:
+			return (_bucket_medium.get_used_count() - _thread_cache_medium.get_count()) * sizeof(BucketMedium);
+		case BUCKET_TYPE_LARGE:
+			return (_bucket_large.get_used_count() - _thread_cache_large.get_count()) * sizeof(BucketLarge);
+	}
+	return 0;
 }
@@ -38,6 +38,15 @@ inline constexpr size_t BUCKET_SMALL = 2 * 3 * sizeof(real_t);
 inline constexpr size_t BUCKET_MEDIUM = 4 * 3 * sizeof(real_t);
 inline constexpr size_t BUCKET_LARGE = 4 * 4 * sizeof(real_t);
 
+enum BucketType {
+	BUCKET_TYPE_SMALL,
+	BUCKET_TYPE_MEDIUM,
+	BUCKET_TYPE_LARGE,
+};
+
+// Memory taken by elements currently in use, in bytes.
+uint64_t get_used_memory(BucketType p_bucket);
+
 void *alloc_small();
 void *alloc_medium();
 void *alloc_large();
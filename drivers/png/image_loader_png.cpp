@@ -34,6 +34,13 @@
 
 Error ImageLoaderPNG::load_image(Ref<Image> p_image, Ref<FileAccess> f, BitField<ImageFormatLoader::LoaderFlags> p_flags, float p_scale) {
 	const uint64_t buffer_size = f->get_length();
+
+	// Decode straight from the file contents if they can be borrowed (e.g. memory mapped), avoiding a copy.
+	const Span<const uint8_t> view = f->get_buffer_view(buffer_size);
+	if (!view.is_empty()) {
+		return PNGDriverCommon::png_to_image(view.ptr(), view.size(), p_flags & FLAG_FORCE_LINEAR, p_image);
+	}
+
 	Vector<uint8_t> file_buffer;
 	Error err = file_buffer.resize(buffer_size);
 	if (err) {
@@ -35,6 +35,7 @@
 #include "core/string/ustring.h"
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #if !defined(__FreeBSD__) && !defined(__OpenBSD__) && !defined(__NetBSD__) && !defined(WEB_ENABLED)
@@ -203,6 +204,13 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	if (mapping) {
+		munmap(mapping, mapping_size);
+		mapping = nullptr;
+		mapping_size = 0;
+	}
+	mapping_failed = false;
+
 	fclose(f);
 	f = nullptr;
 
@@ -308,6 +316,53 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+bool FileAccessUnix::_map() const {
+	if (mapping) {
+		return true;
+	}
+	if (mapping_failed || flags != READ) {
+		return false;
+	}
+
+	struct stat st = {};
+	if (fstat(fileno(f), &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0) {
+		mapping_failed = true;
+		return false;
+	}
+
+	void *ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+	if (ptr == MAP_FAILED) {
+		mapping_failed = true;
+		return false;
+	}
+
+	mapping = (uint8_t *)ptr;
+	mapping_size = st.st_size;
+	return true;
+}
+
+Span<const uint8_t> FileAccessUnix::get_buffer_view(uint64_t p_length) const {
+	ERR_FAIL_NULL_V_MSG(f, Span<const uint8_t>(), "File must be opened before use.");
+
+	if (!_map()) {
+		return Span<const uint8_t>();
+	}
+
+	const uint64_t pos = get_position();
+	if (pos >= mapping_size) {
+		return Span<const uint8_t>();
+	}
+
+	const uint64_t read = MIN(p_length, mapping_size - pos);
+	if (fseeko(f, pos + read, SEEK_SET)) {
+		check_errors();
+		return Span<const uint8_t>();
+	}
+	last_error = OK;
+
+	return Span<const uint8_t>(mapping + pos, read);
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -47,6 +47,12 @@ class FileAccessUnix : public FileAccess {
 	String path;
 	String path_src;
 
+	// Read only files are memory mapped on demand, to lend out views of their contents.
+	mutable uint8_t *mapping = nullptr;
+	mutable uint64_t mapping_size = 0;
+	mutable bool mapping_failed = false;
+
+	bool _map() const;
 	void _close();
 
 #if defined(TOOLS_ENABLED)
@@ -71,6 +77,7 @@ public:
 	virtual bool eof_reached() const override; ///< reading passed EOF
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual Span<const uint8_t> get_buffer_view(uint64_t p_length) const override;
 
 	virtual Error get_error() const override; ///< get last error
 
@@ -35,8 +35,10 @@
 #include "core/object/class_db.h"
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
+#include "core/variant/variant_pools.h"
 #include "scene/main/node.h"
 #include "scene/main/scene_tree.h"
+#include "scene/resources/scene_pool.h"
 #include "servers/audio/audio_server.h"
 #include "servers/rendering/rendering_server.h"
 
@@ -135,6 +137,12 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
+	BIND_ENUM_CONSTANT(MEMORY_VARIANT_POOL_SMALL);
+	BIND_ENUM_CONSTANT(MEMORY_VARIANT_POOL_MEDIUM);
+	BIND_ENUM_CONSTANT(MEMORY_VARIANT_POOL_LARGE);
+	BIND_ENUM_CONSTANT(OBJECT_SCENE_POOL_HITS);
+	BIND_ENUM_CONSTANT(OBJECT_SCENE_POOL_MISSES);
+	BIND_ENUM_CONSTANT(OBJECT_SCENE_POOL_AVAILABLE);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 
 	BIND_ENUM_CONSTANT(MONITOR_TYPE_QUANTITY);
@@ -230,6 +238,12 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
 #endif // NAVIGATION_3D_DISABLED
+		PNAME("memory/variant_pool_small"),
+		PNAME("memory/variant_pool_medium"),
+		PNAME("memory/variant_pool_large"),
+		PNAME("object/scene_pool_hits"),
+		PNAME("object/scene_pool_misses"),
+		PNAME("object/scene_pool_available"),
 	};
 	static_assert(std_size(names) == MONITOR_MAX);
 
@@ -254,6 +268,12 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return Memory::get_mem_max_usage();
 		case MEMORY_MESSAGE_BUFFER_MAX:
 			return MessageQueue::get_singleton()->get_max_buffer_usage();
+		case MEMORY_VARIANT_POOL_SMALL:
+			return VariantPools::get_used_memory(VariantPools::BUCKET_TYPE_SMALL);
+		case MEMORY_VARIANT_POOL_MEDIUM:
+			return VariantPools::get_used_memory(VariantPools::BUCKET_TYPE_MEDIUM);
+		case MEMORY_VARIANT_POOL_LARGE:
+			return VariantPools::get_used_memory(VariantPools::BUCKET_TYPE_LARGE);
 		case OBJECT_COUNT:
 			return ObjectDB::get_object_count();
 		case OBJECT_RESOURCE_COUNT:
@@ -262,6 +282,12 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return _get_node_count();
 		case OBJECT_ORPHAN_NODE_COUNT:
 			return _get_orphan_node_count();
+		case OBJECT_SCENE_POOL_HITS:
+			return ScenePool::get_total_hit_count();
+		case OBJECT_SCENE_POOL_MISSES:
+			return ScenePool::get_total_miss_count();
+		case OBJECT_SCENE_POOL_AVAILABLE:
+			return ScenePool::get_total_available_count();
 		case RENDER_TOTAL_OBJECTS_IN_FRAME:
 			return RS::get_singleton()->get_rendering_info(RSE::RENDERING_INFO_TOTAL_OBJECTS_IN_FRAME);
 		case RENDER_TOTAL_PRIMITIVES_IN_FRAME:
@@ -527,7 +553,12 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 #endif // _3D_DISABLED
-
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
 
@@ -122,6 +122,12 @@ public:
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
 #endif // _3D_DISABLED
+		MEMORY_VARIANT_POOL_SMALL,
+		MEMORY_VARIANT_POOL_MEDIUM,
+		MEMORY_VARIANT_POOL_LARGE,
+		OBJECT_SCENE_POOL_HITS,
+		OBJECT_SCENE_POOL_MISSES,
+		OBJECT_SCENE_POOL_AVAILABLE,
 		MONITOR_MAX
 	};
 
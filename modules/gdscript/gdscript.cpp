@@ -1442,6 +1442,7 @@ void GDScript::clear() {
 		functions_to_clear.insert(E.value);
 	}
 	member_functions.clear();
+	notification_function = nullptr;
 
 	for (KeyValue<StringName, MemberInfo> &E : member_indices) {
 		E.value.data_type.script_type_ref = Ref<Script>();
@@ -1924,6 +1925,17 @@ Variant GDScriptInstance::callp(const StringName &p_method, const Variant **p_ar
 	return Variant();
 }
 
+void GDScriptInstance::_call_notification_recursively(GDScript *p_script, const Variant **p_args) {
+	// Call base class first.
+	if (p_script->base.ptr()) {
+		_call_notification_recursively(p_script->base.ptr(), p_args);
+	}
+	if (likely(p_script->valid) && p_script->notification_function) {
+		Callable::CallError err;
+		p_script->notification_function->call(this, p_args, 1, err);
+	}
+}
+
 void GDScriptInstance::notification(int p_notification, bool p_reversed) {
 	if (unlikely(!script->valid)) {
 		return;
@@ -1932,29 +1944,16 @@ void GDScriptInstance::notification(int p_notification, bool p_reversed) {
 	//notification is not virtual, it gets called at ALL levels just like in C.
 	Variant value = p_notification;
 	const Variant *args[1] = { &value };
-	const StringName &notification_str = GDScriptLanguage::get_singleton()->strings._notification;
 
-	LocalVector<GDScript *> script_stack;
-	uint32_t script_count = 0;
-	for (GDScript *sptr = script.ptr(); sptr; sptr = sptr->base.ptr(), ++script_count) {
-		script_stack.push_back(sptr);
+	if (!p_reversed) {
+		_call_notification_recursively(script.ptr(), args);
+		return;
 	}
 
-	const int start = p_reversed ? 0 : script_count - 1;
-	const int end = p_reversed ? script_count : -1;
-	const int step = p_reversed ? 1 : -1;
-
-	for (int idx = start; idx != end; idx += step) {
-		GDScript *sc = script_stack[idx];
-		if (likely(sc->valid)) {
-			HashMap<StringName, GDScriptFunction *>::Iterator E = sc->member_functions.find(notification_str);
-			if (E) {
-				Callable::CallError err;
-				E->value->call(this, args, 1, err);
-				if (err.error != Callable::CallError::CALL_OK) {
-					//print error about notification call
-				}
-			}
+	for (GDScript *sc = script.ptr(); sc; sc = sc->base.ptr()) {
+		if (likely(sc->valid) && sc->notification_function) {
+			Callable::CallError err;
+			sc->notification_function->call(this, args, 1, err);
 		}
 	}
 }
@@ -166,6 +166,7 @@ private:
 #endif
 
 	GDScriptFunction *initializer = nullptr; // Direct pointer to `new()`/`_init()` member function, faster to locate.
+	GDScriptFunction *notification_function = nullptr; // Direct pointer to `_notification()` member function, faster to locate.
 
 	GDScriptFunction *implicit_initializer = nullptr; // `@implicit_new()` special function.
 	GDScriptFunction *implicit_ready = nullptr; // `@implicit_ready()` special function.
@@ -367,6 +368,7 @@ class GDScriptInstance : public ScriptInstance {
 	SelfList<GDScriptFunctionState>::List pending_func_states;
 
 	void _call_implicit_ready_recursively(GDScript *p_script);
+	void _call_notification_recursively(GDScript *p_script, const Variant **p_args);
 
 public:
 	virtual Object *get_owner() { return owner; }
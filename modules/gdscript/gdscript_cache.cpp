@@ -299,7 +299,45 @@ Vector<uint8_t> GDScriptCache::get_binary_tokens(const String &p_path) {
 	return buffer;
 }
 
+// Parsing only needs the source, so when the calling thread isn't already inside the cache (as it is
+// while resolving dependencies), do it without holding the mutex. This way scripts loaded from several
+// threads at once are parsed concurrently instead of one after the other.
+// The result is registered in the parser map, unless another thread got there first.
+Ref<GDScriptParserRef> GDScriptCache::_parse_outside_lock(const String &p_path) {
+	if (singleton->mutex.is_locked_by_current_thread()) {
+		return Ref<GDScriptParserRef>();
+	}
+
+	{
+		MutexLock lock(singleton->mutex);
+		if (singleton->cleared || singleton->full_gdscript_cache.has(p_path) || singleton->shallow_gdscript_cache.has(p_path) || singleton->parser_map.has(p_path)) {
+			return Ref<GDScriptParserRef>();
+		}
+	}
+
+	Ref<GDScriptParserRef> ref;
+	ref.instantiate();
+	ref->path = p_path;
+	ref->abandoned = true; // Not in the parser map yet, so it must not erase anything from it if discarded.
+
+	if (!FileAccess::exists(ResourceLoader::path_remap(p_path)) || ref->raise_status(GDScriptParserRef::PARSED) != OK) {
+		// Let the regular path report the error.
+		return Ref<GDScriptParserRef>();
+	}
+
+	MutexLock lock(singleton->mutex);
+	if (singleton->parser_map.has(p_path)) {
+		return Ref<GDScriptParserRef>();
+	}
+	ref->abandoned = false;
+	singleton->parser_map[p_path] = ref.ptr();
+	return ref;
+}
+
 Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_error, const String &p_owner) {
+	// Keeps the parser alive until the script is made from it through `get_parser()`.
+	Ref<GDScriptParserRef> parsed_ref = _parse_outside_lock(p_path);
+
 	MutexLock lock(singleton->mutex);
 
 	if (!p_owner.is_empty() && p_path != p_owner) {
@@ -343,6 +381,10 @@ Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_e
 }
 
 Ref<GDScript> GDScriptCache::get_full_script(const String &p_path, Error &r_error, const String &p_owner, bool p_update_from_disk) {
+	// Keeps the parser alive until the shallow script is made from it by `get_shallow_script()`.
+	// Compiling the full script in `reload()` parses the source again on its own.
+	Ref<GDScriptParserRef> parsed_ref = _parse_outside_lock(p_path);
+
 	MutexLock lock(singleton->mutex);
 
 	if (!p_owner.is_empty() && p_path != p_owner) {
@@ -252,6 +252,25 @@ static bool _can_use_validate_call(const MethodBind *p_method, const Vector<GDSc
 	return true;
 }
 
+bool GDScriptCompiler::_can_operate_in_place(const GDScriptCodeGenerator::Address &p_target, Variant::Operator p_operator, const GDScriptCodeGenerator::Address &p_operand) {
+	if (p_target.mode != GDScriptCodeGenerator::Address::LOCAL_VARIABLE && p_target.mode != GDScriptCodeGenerator::Address::FUNCTION_PARAMETER) {
+		return false;
+	}
+	if (p_target.type.kind != GDScriptDataType::BUILTIN || p_operand.type.kind != GDScriptDataType::BUILTIN) {
+		return false;
+	}
+	const Variant::Type target_type = p_target.type.builtin_type;
+	if (target_type == Variant::NIL || target_type == Variant::ARRAY || target_type == Variant::DICTIONARY) {
+		// Typed containers need their element types to be checked when assigned.
+		return false;
+	}
+	if (target_type >= Variant::PACKED_BYTE_ARRAY) {
+		// Packed arrays would be appended to in place, changing the arrays shared with other variables.
+		return false;
+	}
+	return Variant::get_operator_return_type(p_operator, target_type, p_operand.type.builtin_type) == target_type;
+}
+
 GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &codegen, Error &r_error, const GDScriptParser::ExpressionNode *p_expression, bool p_root, bool p_initializer) {
 	if (p_expression->is_constant && !(p_expression->get_datatype().is_meta_type && p_expression->get_datatype().kind == GDScriptParser::DataType::CLASS)) {
 		return codegen.add_constant(p_expression->reduced_value);
@@ -1344,6 +1363,16 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 
 				GDScriptCodeGenerator::Address to_assign;
 				bool has_operation = assignment->operation != GDScriptParser::AssignmentNode::OP_NONE;
+				if (has_operation && !is_member && !assignment->use_conversion_assign && _can_operate_in_place(target, assignment->variant_op, assigned_value)) {
+					// Typed local or parameter whose type the operation preserves (e.g. `i += 1` with `i: int`).
+					// Operate straight into it, saving a temporary and the assignment from it.
+					gen->write_binary_operator(target, assignment->variant_op, target, assigned_value);
+
+					if (assigned_value.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+						gen->pop_temporary();
+					}
+					return GDScriptCodeGenerator::Address(); // Assignment does not return a value.
+				}
 				if (has_operation) {
 					// Perform operation.
 					GDScriptCodeGenerator::Address op_result = codegen.add_temporary(_gdtype_from_datatype(assignment->get_datatype(), codegen.script));
@@ -2361,6 +2390,7 @@ GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_
 	// Parse initializer if applies.
 	bool is_implicit_initializer = !p_for_ready && !p_func && !p_for_lambda;
 	bool is_initializer = p_func && !p_for_lambda && p_func->identifier->name == GDScriptLanguage::get_singleton()->strings._init;
+	bool is_notification = p_func && !p_for_lambda && p_func->identifier->name == GDScriptLanguage::get_singleton()->strings._notification;
 	bool is_implicit_ready = !p_func && p_for_ready;
 
 	if (!p_for_lambda && is_implicit_initializer) {
@@ -2504,6 +2534,8 @@ GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_
 
 	if (is_initializer) {
 		p_script->initializer = gd_function;
+	} else if (is_notification) {
+		p_script->notification_function = gd_function;
 	} else if (is_implicit_initializer) {
 		p_script->implicit_initializer = gd_function;
 	} else if (is_implicit_ready) {
@@ -2746,6 +2778,7 @@ Error GDScriptCompiler::_prepare_compilation(GDScript *p_script, const GDScriptP
 	p_script->static_variables.clear();
 	p_script->_signals.clear();
 	p_script->initializer = nullptr;
+	p_script->notification_function = nullptr;
 	p_script->implicit_initializer = nullptr;
 	p_script->implicit_ready = nullptr;
 	p_script->static_initializer = nullptr;
@@ -152,6 +152,7 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_DICTIONARY,
@@ -337,6 +338,25 @@ public:
 		StringName identifier;
 	};
 
+	// Remembers what a named access or method call on an untyped value resolved to for the
+	// native classes of its receivers. Misses add entries for new classes, up to a few lookups.
+	// Entries never change once filled, so threads running the same function share them freely.
+	struct InlineCache {
+		static constexpr uint32_t MAX_ENTRIES = 4;
+		// Bounds lookups on misses, so sites seeing many classes or receivers that can't be cached stop paying for them.
+		static constexpr uint32_t MAX_LOOKUPS = 16;
+
+		struct Entry {
+			SafeFlag ready;
+			const GDType *type = nullptr;
+			MethodBind *method = nullptr;
+		};
+
+		SafeNumeric<uint32_t> lookups;
+		SafeNumeric<uint32_t> used;
+		Entry entries[MAX_ENTRIES];
+	};
+
 private:
 	friend class GDScript;
 	friend class GDScriptCompiler;
@@ -399,6 +419,7 @@ private:
 	int _gds_utilities_count = 0;
 	int _methods_count = 0;
 	int _lambdas_count = 0;
+	int _inline_caches_count = 0;
 
 	int *_code_ptr = nullptr;
 	const int *_default_arg_ptr = nullptr;
@@ -417,6 +438,7 @@ private:
 	const GDScriptUtilityFunctions::FunctionPtr *_gds_utilities_ptr = nullptr;
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
+	InlineCache *_inline_caches_ptr = nullptr;
 
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
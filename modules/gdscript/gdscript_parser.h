@@ -1713,5 +1713,6 @@ public:
 		void print_tree(const GDScriptParser &p_parser);
 	};
 #endif // DEBUG_ENABLED
+	static void initialize();
 	static void cleanup();
 };
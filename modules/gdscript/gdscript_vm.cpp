@@ -209,6 +209,53 @@ String GDScriptFunction::_get_callable_call_error(const String &p_where, const C
 	}
 }
 
+// Only receivers of native classes take part in inline caching: scripts can override any member,
+// and extension classes can be unloaded along with their method binds.
+static Object *_get_inline_cacheable_object(const Variant *p_base) {
+	Object *obj = p_base->get_validated_object();
+	if (!obj || obj->get_script_instance()) {
+		return nullptr;
+	}
+	const ClassDB::APIType api = ClassDB::get_api_type(obj->get_class_name());
+	return (api == ClassDB::API_CORE || api == ClassDB::API_EDITOR) ? obj : nullptr;
+}
+
+// Returns the cached method for the receiver's class, null if the access must be resolved by name.
+static _FORCE_INLINE_ MethodBind *_get_inline_cache_hit(const GDScriptFunction::InlineCache &p_cache, const Variant *p_base, Object *&r_object) {
+	if (p_cache.used.get() == 0 || p_base->get_type() != Variant::OBJECT) {
+		return nullptr;
+	}
+	Object *obj = p_base->get_validated_object();
+	if (!obj || obj->get_script_instance()) {
+		return nullptr;
+	}
+	const GDType *type = &obj->get_gdtype();
+	for (const GDScriptFunction::InlineCache::Entry &entry : p_cache.entries) {
+		if (entry.ready.is_set() && entry.type == type) {
+			r_object = obj;
+			return entry.method;
+		}
+	}
+	return nullptr;
+}
+
+// Misses look the member up again until the cache is full or out of lookups.
+static _FORCE_INLINE_ bool _claim_inline_cache_lookup(GDScriptFunction::InlineCache &r_cache) {
+	return r_cache.used.get() < GDScriptFunction::InlineCache::MAX_ENTRIES && r_cache.lookups.get() < GDScriptFunction::InlineCache::MAX_LOOKUPS && r_cache.lookups.postincrement() < GDScriptFunction::InlineCache::MAX_LOOKUPS;
+}
+
+// Each entry is claimed by a single thread and filled once.
+static void _fill_inline_cache(GDScriptFunction::InlineCache &r_cache, const Object *p_object, MethodBind *p_method) {
+	const uint32_t index = r_cache.used.postincrement();
+	if (index >= GDScriptFunction::InlineCache::MAX_ENTRIES) {
+		return;
+	}
+	GDScriptFunction::InlineCache::Entry &entry = r_cache.entries[index];
+	entry.type = &p_object->get_gdtype();
+	entry.method = p_method;
+	entry.ready.set();
+}
+
 void (*type_init_function_table[])(Variant *) = {
 	nullptr, // NIL (shouldn't be called).
 	&VariantInitializer<bool>::init, // BOOL.
@@ -256,6 +303,7 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = { \
 		&&OPCODE_OPERATOR, \
 		&&OPCODE_OPERATOR_VALIDATED, \
+		&&OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT, \
 		&&OPCODE_TYPE_TEST_BUILTIN, \
 		&&OPCODE_TYPE_TEST_ARRAY, \
 		&&OPCODE_TYPE_TEST_DICTIONARY, \
@@ -853,6 +901,31 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT) {
+				CHECK_SPACE(6);
+
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				operator_func(a, b, dst);
+
+				bool result = dst->get_type() == Variant::BOOL ? *VariantInternal::get_bool(dst) : dst->booleanize();
+
+				if (!result) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -1197,7 +1270,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
@@ -1207,8 +1280,32 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_caches_count);
+				InlineCache &cache = _inline_caches_ptr[cache_idx];
+
 				bool valid;
-				dst->set_named(*index, *value, valid);
+				Object *cached_obj = nullptr;
+				MethodBind *cached_method = _get_inline_cache_hit(cache, dst, cached_obj);
+				if (cached_obj) {
+#ifdef TOOLS_ENABLED
+					cached_obj->set_edited(true);
+#endif
+					const Variant *args[1] = { value };
+					Callable::CallError ce;
+					cached_method->call(cached_obj, args, 1, ce);
+					valid = ce.error == Callable::CallError::CALL_OK;
+				} else {
+					if (unlikely(_claim_inline_cache_lookup(cache))) {
+						// Same lookup as `ClassDB::set_property()`, limited to setters not taking an index.
+						Object *obj = _get_inline_cacheable_object(dst);
+						const ClassDB::PropertySetGet *psg = obj ? ClassDB::get_property_setget(obj->get_class_name(), *index) : nullptr;
+						if (psg && psg->index < 0 && psg->_setptr) {
+							_fill_inline_cache(cache, obj, psg->_setptr);
+						}
+					}
+					dst->set_named(*index, *value, valid);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1229,7 +1326,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1249,7 +1346,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1259,22 +1356,42 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_caches_count);
+				InlineCache &cache = _inline_caches_ptr[cache_idx];
+
+				Object *cached_obj = nullptr;
+				MethodBind *cached_method = _get_inline_cache_hit(cache, src, cached_obj);
+				if (cached_obj) {
+					Callable::CallError ce;
+					*dst = cached_method->call(cached_obj, nullptr, 0, ce);
+				} else {
+					if (unlikely(_claim_inline_cache_lookup(cache))) {
+						// Same lookup as `ClassDB::get_property()`, limited to getters not taking an index.
+						Object *obj = _get_inline_cacheable_object(src);
+						const ClassDB::PropertySetGet *psg = obj ? ClassDB::get_property_setget(obj->get_class_name(), *index) : nullptr;
+						if (psg && psg->index < 0 && psg->_getptr) {
+							_fill_inline_cache(cache, obj, psg->_getptr);
+						}
+					}
+
+					bool valid;
 #ifdef DEBUG_ENABLED
-				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
+					//allow better error message in cases where src and dst are the same stack position
+					Variant ret = src->get_named(*index, valid);
 
 #else
-				*dst = src->get_named(*index, valid);
+					*dst = src->get_named(*index, valid);
 #endif
 #ifdef DEBUG_ENABLED
-				if (!valid) {
-					err_text = "Invalid access to property or key '" + index->operator String() + "' on a base object of type '" + _get_var_type(src) + "'.";
-					OPCODE_BREAK;
-				}
-				*dst = ret;
+					if (!valid) {
+						err_text = "Invalid access to property or key '" + index->operator String() + "' on a base object of type '" + _get_var_type(src) + "'.";
+						OPCODE_BREAK;
+					}
+					*dst = ret;
 #endif
-				ip += 4;
+				}
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1897,7 +2014,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
 				LOAD_INSTRUCTION_ARGS
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 
 				ip += instr_arg_count;
 
@@ -1908,11 +2025,26 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(methodname_idx < 0 || methodname_idx >= _global_names_count);
 				const StringName *methodname = &_global_names_ptr[methodname_idx];
 
+				int cache_idx = _code_ptr[ip + 3];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_caches_count);
+				InlineCache &cache = _inline_caches_ptr[cache_idx];
+
 				GodotProfileZoneScriptSystemCall(methodname, source, name, *methodname, line);
 
 				GET_INSTRUCTION_ARG(base, argc);
 				Variant **argptrs = instruction_args;
 
+				Object *cached_obj = nullptr;
+				MethodBind *cached_method = _get_inline_cache_hit(cache, base, cached_obj);
+				if (!cached_obj && unlikely(_claim_inline_cache_lookup(cache))) {
+					// Same lookup as `Object::callp()` does once script instances are ruled out.
+					Object *obj = _get_inline_cacheable_object(base);
+					MethodBind *method = (obj && *methodname != CoreStringName(free_)) ? ClassDB::get_method(obj->get_class_name(), *methodname) : nullptr;
+					if (method) {
+						_fill_inline_cache(cache, obj, method);
+					}
+				}
+
 #ifdef DEBUG_ENABLED
 				uint64_t call_time = 0;
 
@@ -1928,7 +2060,15 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				Callable::CallError err;
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					if (cached_obj) {
+#ifdef DEBUG_ENABLED
+						// Locked like in `Object::callp()`, so the receiver can't free itself during the call.
+						_ObjectDebugLock debug_lock(cached_obj);
+#endif
+						temp_ret = cached_method->call(cached_obj, (const Variant **)argptrs, argc, err);
+					} else {
+						base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					}
 					*ret = temp_ret;
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
@@ -1957,6 +2097,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						}
 					}
 #endif
+				} else if (cached_obj) {
+#ifdef DEBUG_ENABLED
+					_ObjectDebugLock debug_lock(cached_obj);
+#endif
+					temp_ret = cached_method->call(cached_obj, (const Variant **)argptrs, argc, err);
 				} else {
 					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
 				}
@@ -2013,7 +2158,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif // DEBUG_ENABLED
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
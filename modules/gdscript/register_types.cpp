@@ -146,6 +146,7 @@ void initialize_gdscript_module(ModuleInitializationLevel p_level) {
 
 		gdscript_cache = memnew(GDScriptCache);
 
+		GDScriptParser::initialize();
 		GDScriptUtilityFunctions::register_functions();
 	}
 
@@ -0,0 +1,24 @@
+const NOTIFICATION_TEST = 12345
+
+class A:
+	func _notification(what: int) -> void:
+		if what == NOTIFICATION_TEST:
+			print("A")
+
+class B extends A:
+	pass
+
+class C extends B:
+	func _notification(what: int) -> void:
+		if what == NOTIFICATION_TEST:
+			print("C")
+
+func test():
+	var c := C.new()
+	print("forward")
+	c.notification(NOTIFICATION_TEST)
+	print("reversed")
+	c.notification(NOTIFICATION_TEST, true)
+	var b := B.new()
+	print("inherited")
+	b.notification(NOTIFICATION_TEST)
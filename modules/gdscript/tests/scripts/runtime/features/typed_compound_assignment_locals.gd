@@ -0,0 +1,57 @@
+# Compound assignments to typed locals and parameters that keep their type are done in place.
+
+func accumulate(count: int, step: float) -> float:
+	var sum := 0.0
+	for _i in count:
+		sum += step
+		step *= 2.0
+		count -= 1
+	return sum
+
+func append_packed(array: PackedInt32Array) -> PackedInt32Array:
+	array += PackedInt32Array([3])
+	return array
+
+func test():
+	var i := 10
+	i += 5
+	i -= 3
+	i *= 2
+	@warning_ignore("integer_division")
+	i /= 5
+	i %= 3
+	i <<= 4
+	i |= 1
+	print(i)
+
+	var f := 1.5
+	f += 1
+	f *= 2
+	print(f)
+
+	var v := Vector2(1, 2)
+	v *= 3.0
+	v += Vector2.ONE
+	print(v)
+
+	var s := "a"
+	for n in 3:
+		s += str(n)
+	print(s)
+
+	print(accumulate(4, 0.5))
+
+	# Operations changing the type still go through conversion.
+	var j := 3
+	@warning_ignore("narrowing_conversion")
+	j *= 1.5
+	print(j)
+
+	# Packed arrays are copied on write, aliases must not see the change.
+	var packed := PackedInt32Array([1, 2])
+	var alias := packed
+	alias += PackedInt32Array([3])
+	print(packed)
+	print(alias)
+	print(append_packed(packed))
+	print(packed)
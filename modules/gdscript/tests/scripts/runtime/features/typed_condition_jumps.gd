@@ -0,0 +1,43 @@
+# Conditions made of a single typed operator are compiled into one fused instruction.
+
+func test():
+	var i := 0
+	var total := 0
+	while i < 10:
+		if i % 2 == 0:
+			total += i
+		elif i >= 7:
+			total += 100
+		i += 1
+	print(total)
+
+	var f := 0.5
+	var steps := 0
+	while f < 4.0:
+		f *= 2.0
+		steps += 1
+	print(steps)
+
+	var v := Vector2(1, 2)
+	print("equal" if v == Vector2(1, 2) else "different")
+	print("equal" if v == Vector2(2, 1) else "different")
+
+	# Non-boolean results are tested for truthiness.
+	var flags := 6
+	if flags & 1:
+		print("bit 0 set")
+	if flags & 2:
+		print("bit 1 set")
+
+	# Jumps into the middle of a fused condition must still work.
+	var a := 3
+	var b := 5
+	if a < b and b < 10:
+		print("both")
+	if a > b or b > 4:
+		print("either")
+	var n := 0
+	for x in 5:
+		if x > 2 if a < b else x < 2:
+			n += 1
+	print(n)
@@ -0,0 +1,25 @@
+# The same untyped access sites see native objects of different classes, and objects
+# with a script attached, so their inline caches must only apply to the right receivers.
+
+class Scripted extends Node:
+	var extra := 1
+
+func read_name(obj):
+	return obj.name
+
+func write_name(obj, value):
+	obj.name = value
+
+func check_class(obj, cls):
+	return obj.is_class(cls)
+
+func test():
+	var receivers = [Node.new(), Node.new(), Node2D.new(), Scripted.new()]
+	for i in receivers.size():
+		write_name(receivers[i], "Receiver%d" % i)
+	for receiver in receivers:
+		print(read_name(receiver))
+	for receiver in receivers:
+		print(check_class(receiver, "Node2D"))
+	for receiver in receivers:
+		receiver.free()
@@ -101,6 +101,8 @@ class GodotBody2D : public GodotCollisionObject2D {
 	bool active = true;
 	bool can_sleep = true;
 	bool first_time_kinematic = false;
+	bool integration_motion_pending = false;
+	Vector2 integration_motion;
 	void _mass_properties_changed();
 	virtual void _shapes_changed() override;
 	Transform2D new_transform;
@@ -315,8 +317,12 @@ public:
 	_FORCE_INLINE_ real_t get_friction() const { return friction; }
 	_FORCE_INLINE_ real_t get_bounce() const { return bounce; }
 
+	// Integration only writes to this body and can run on any thread.
+	// The matching `finish` call updates the space and must run on a single thread afterwards.
 	void integrate_forces(real_t p_step);
+	void integrate_forces_finish();
 	void integrate_velocities(real_t p_step);
+	void integrate_velocities_finish();
 
 	_FORCE_INLINE_ Vector2 get_velocity_in_local_point(const Vector2 &rel_pos) const {
 		return linear_velocity + Vector2(-angular_velocity * rel_pos.y, angular_velocity * rel_pos.x);
@@ -714,8 +714,16 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 	Transform3D transform_new = get_transform();
 
 	if (!Math::is_zero_approx(ang_vel)) {
-		Vector3 ang_vel_axis = total_angular_velocity / ang_vel;
-		Basis rot(ang_vel_axis, ang_vel * p_step);
+		Basis rot;
+		if (get_space()->is_deterministic_simulation()) {
+			// First order quaternion integration, which avoids trigonometric functions
+			// whose results can differ between platforms.
+			Vector3 half_rotation = total_angular_velocity * (p_step * 0.5);
+			rot = Basis(Quaternion(half_rotation.x, half_rotation.y, half_rotation.z, 1.0).normalized());
+		} else {
+			Vector3 ang_vel_axis = total_angular_velocity / ang_vel;
+			rot = Basis(ang_vel_axis, ang_vel * p_step);
+		}
 		Basis identity3(1, 0, 0, 0, 1, 0, 0, 0, 1);
 		transform_new.origin += ((identity3 - rot) * transform_new.basis).xform(center_of_mass_local);
 		transform_new.basis = rot * transform_new.basis;
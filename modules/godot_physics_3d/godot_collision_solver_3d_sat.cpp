@@ -637,19 +637,29 @@ public:
 		}
 	}
 
-	_FORCE_INLINE_ bool test_axis(const Vector3 &p_axis) {
-		Vector3 axis = p_axis;
-
-		if (axis.is_zero_approx()) {
+	static _FORCE_INLINE_ Vector3 get_valid_axis(const Vector3 &p_axis) {
+		if (p_axis.is_zero_approx()) {
 			// strange case, try an upwards separator
-			axis = Vector3(0.0, 1.0, 0.0);
+			return Vector3(0.0, 1.0, 0.0);
 		}
+		return p_axis;
+	}
+
+	_FORCE_INLINE_ bool test_axis(const Vector3 &p_axis) {
+		Vector3 axis = get_valid_axis(p_axis);
 
 		real_t min_A = 0.0, max_A = 0.0, min_B = 0.0, max_B = 0.0;
 
 		shape_A->project_range(axis, *transform_A, min_A, max_A);
 		shape_B->project_range(axis, *transform_B, min_B, max_B);
 
+		return test_axis_range(axis, min_A, max_A, min_B, max_B);
+	}
+
+	// Same as test_axis(), for a valid axis both shapes were already projected on.
+	_FORCE_INLINE_ bool test_axis_range(const Vector3 &p_axis, real_t p_min_A, real_t p_max_A, real_t p_min_B, real_t p_max_B) {
+		real_t min_A = p_min_A, max_A = p_max_A, min_B = p_min_B, max_B = p_max_B;
+
 		if (withMargin) {
 			min_A -= margin_A;
 			max_A += margin_A;
@@ -664,7 +674,7 @@ public:
 		max_B -= (min_A + max_A) * 0.5;
 
 		if (min_B > 0.0 || max_B < 0.0) {
-			separator_axis = axis;
+			separator_axis = p_axis;
 			return false; // doesn't contain 0
 		}
 
@@ -677,12 +687,12 @@ public:
 		if (max_B < min_B) {
 			if (max_B < best_depth) {
 				best_depth = max_B;
-				best_axis = axis;
+				best_axis = p_axis;
 			}
 		} else {
 			if (min_B < best_depth) {
 				best_depth = min_B;
-				best_axis = -axis; // keep it as A axis
+				best_axis = -p_axis; // keep it as A axis
 			}
 		}
 
@@ -1070,38 +1080,86 @@ static void _collision_sphere_face(const GodotShape3D *p_a, const Transform3D &p
 	separator.generate_contacts();
 }
 
-template <bool withMargin>
+// Projects a box on several axes at once, with the same math as GodotBoxShape3D::project_range().
+// The loop has no calls or branches, so the compiler can vectorize it.
+static _FORCE_INLINE_ void _project_box_ranges(const Vector3 &p_half_extents, const Transform3D &p_transform, const Vector3 *p_axes, int p_axis_count, real_t *r_min, real_t *r_max) {
+	for (int i = 0; i < p_axis_count; i++) {
+		Vector3 local_axis = p_transform.basis.xform_inv(p_axes[i]);
+
+		real_t length = local_axis.abs().dot(p_half_extents);
+		real_t distance = p_axes[i].dot(p_transform.origin);
+
+		r_min[i] = distance - length;
+		r_max[i] = distance + length;
+	}
+}
+
+// With `batchedAxes` false, axes are tested one by one with `test_axis()`, which tests compare the batches against.
+template <bool withMargin, bool batchedAxes = true>
+static _FORCE_INLINE_ bool _test_box_box_axes(SeparatorAxisTest<GodotBoxShape3D, GodotBoxShape3D, withMargin> &p_separator, const GodotBoxShape3D *p_box_A, const Transform3D &p_transform_a, const GodotBoxShape3D *p_box_B, const Transform3D &p_transform_b, const Vector3 *p_axes, int p_axis_count) {
+	if constexpr (!batchedAxes) {
+		for (int i = 0; i < p_axis_count; i++) {
+			if (!p_separator.test_axis(p_axes[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	real_t min_A[9], max_A[9], min_B[9], max_B[9];
+	DEV_ASSERT(p_axis_count <= 9);
+
+	_project_box_ranges(p_box_A->get_half_extents(), p_transform_a, p_axes, p_axis_count, min_A, max_A);
+	_project_box_ranges(p_box_B->get_half_extents(), p_transform_b, p_axes, p_axis_count, min_B, max_B);
+
+	// Axes are still tested in order, so the best axis is the same as when testing them one by one.
+	for (int i = 0; i < p_axis_count; i++) {
+		if (!p_separator.test_axis_range(p_axes[i], min_A[i], max_A[i], min_B[i], max_B[i])) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <bool withMargin, bool batchedAxes = true>
 static void _collision_box_box(const GodotShape3D *p_a, const Transform3D &p_transform_a, const GodotShape3D *p_b, const Transform3D &p_transform_b, _CollectorCallback *p_collector, real_t p_margin_a, real_t p_margin_b) {
 	const GodotBoxShape3D *box_A = static_cast<const GodotBoxShape3D *>(p_a);
 	const GodotBoxShape3D *box_B = static_cast<const GodotBoxShape3D *>(p_b);
 
-	SeparatorAxisTest<GodotBoxShape3D, GodotBoxShape3D, withMargin> separator(box_A, p_transform_a, box_B, p_transform_b, p_collector, p_margin_a, p_margin_b);
+	typedef SeparatorAxisTest<GodotBoxShape3D, GodotBoxShape3D, withMargin> BoxSeparatorAxisTest;
+	BoxSeparatorAxisTest separator(box_A, p_transform_a, box_B, p_transform_b, p_collector, p_margin_a, p_margin_b);
 
 	if (!separator.test_previous_axis()) {
 		return;
 	}
 
+	// Axes are projected in batches (faces of A, faces of B, combined edges),
+	// which still allows an early out when one of the face axes separates the boxes.
+	Vector3 axes[9];
+
 	// test faces of A
 
 	for (int i = 0; i < 3; i++) {
-		Vector3 axis = p_transform_a.basis.get_column(i).normalized();
+		axes[i] = BoxSeparatorAxisTest::get_valid_axis(p_transform_a.basis.get_column(i).normalized());
+	}
 
-		if (!separator.test_axis(axis)) {
-			return;
-		}
+	if (!_test_box_box_axes<withMargin, batchedAxes>(separator, box_A, p_transform_a, box_B, p_transform_b, axes, 3)) {
+		return;
 	}
 
 	// test faces of B
 
 	for (int i = 0; i < 3; i++) {
-		Vector3 axis = p_transform_b.basis.get_column(i).normalized();
+		axes[i] = BoxSeparatorAxisTest::get_valid_axis(p_transform_b.basis.get_column(i).normalized());
+	}
 
-		if (!separator.test_axis(axis)) {
-			return;
-		}
+	if (!_test_box_box_axes<withMargin, batchedAxes>(separator, box_A, p_transform_a, box_B, p_transform_b, axes, 3)) {
+		return;
 	}
 
 	// test combined edges
+	int edge_axis_count = 0;
 	for (int i = 0; i < 3; i++) {
 		for (int j = 0; j < 3; j++) {
 			Vector3 axis = p_transform_a.basis.get_column(i).cross(p_transform_b.basis.get_column(j));
@@ -1109,14 +1167,15 @@ static void _collision_box_box(const GodotShape3D *p_a, const Transform3D &p_tra
 			if (Math::is_zero_approx(axis.length_squared())) {
 				continue;
 			}
-			axis.normalize();
 
-			if (!separator.test_axis(axis)) {
-				return;
-			}
+			axes[edge_axis_count++] = BoxSeparatorAxisTest::get_valid_axis(axis.normalized());
 		}
 	}
 
+	if (!_test_box_box_axes<withMargin, batchedAxes>(separator, box_A, p_transform_a, box_B, p_transform_b, axes, edge_axis_count)) {
+		return;
+	}
+
 	if (withMargin) {
 		//add endpoint test between closest vertices and edges
 
@@ -2417,3 +2476,24 @@ bool sat_calculate_penetration(const GodotShape3D *p_shape_A, const Transform3D
 
 	return callback.collided;
 }
+
+#ifdef TESTS_ENABLED
+bool sat_calculate_penetration_box_box_single_axes(const GodotShape3D *p_box_A, const Transform3D &p_transform_A, const GodotShape3D *p_box_B, const Transform3D &p_transform_B, GodotCollisionSolver3D::CallbackResult p_result_callback, void *p_userdata, Vector3 *r_prev_axis, real_t p_margin_a, real_t p_margin_b) {
+	ERR_FAIL_COND_V(p_box_A->get_type() != PhysicsServer3D::SHAPE_BOX, false);
+	ERR_FAIL_COND_V(p_box_B->get_type() != PhysicsServer3D::SHAPE_BOX, false);
+
+	_CollectorCallback callback;
+	callback.callback = p_result_callback;
+	callback.userdata = p_userdata;
+	callback.collided = false;
+	callback.prev_axis = r_prev_axis;
+
+	if (p_margin_a != 0.0 || p_margin_b != 0.0) {
+		_collision_box_box<true, false>(p_box_A, p_transform_A, p_box_B, p_transform_B, &callback, p_margin_a, p_margin_b);
+	} else {
+		_collision_box_box<false, false>(p_box_A, p_transform_A, p_box_B, p_transform_B, &callback, p_margin_a, p_margin_b);
+	}
+
+	return callback.collided;
+}
+#endif // TESTS_ENABLED
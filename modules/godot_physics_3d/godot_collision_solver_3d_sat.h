@@ -33,3 +33,8 @@
 #include "godot_collision_solver_3d.h"
 
 bool sat_calculate_penetration(const GodotShape3D *p_shape_A, const Transform3D &p_transform_A, const GodotShape3D *p_shape_B, const Transform3D &p_transform_B, GodotCollisionSolver3D::CallbackResult p_result_callback, void *p_userdata, bool p_swap = false, Vector3 *r_prev_axis = nullptr, real_t p_margin_a = 0, real_t p_margin_b = 0);
+
+#ifdef TESTS_ENABLED
+// Same as `sat_calculate_penetration()` for two boxes, testing separating axes one by one instead of in batches.
+bool sat_calculate_penetration_box_box_single_axes(const GodotShape3D *p_box_A, const Transform3D &p_transform_A, const GodotShape3D *p_box_B, const Transform3D &p_transform_B, GodotCollisionSolver3D::CallbackResult p_result_callback, void *p_userdata, Vector3 *r_prev_axis = nullptr, real_t p_margin_a = 0, real_t p_margin_b = 0);
+#endif // TESTS_ENABLED
@@ -70,6 +70,11 @@ class GodotPhysicsServer3D : public PhysicsServer3D {
 	static GodotPhysicsServer3D *godot_singleton;
 
 public:
+#ifdef TESTS_ENABLED
+	static GodotPhysicsServer3D *get_godot_singleton() { return godot_singleton; }
+	GodotStep3D *get_stepper() const { return stepper; }
+#endif // TESTS_ENABLED
+
 	struct CollCbkData {
 		int max;
 		int amount;
@@ -115,6 +120,7 @@ public:
 	virtual void space_set_debug_contacts(RID p_space, int p_max_contacts) override;
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
+	virtual uint64_t space_get_state_hash(RID p_space) const override;
 
 	/* AREA API */
 
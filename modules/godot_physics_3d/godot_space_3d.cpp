@@ -34,6 +34,7 @@
 #include "godot_physics_server_3d.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "godot_area_pair_3d.h"
 #include "godot_body_pair_3d.h"
 
@@ -107,16 +108,14 @@ int GodotPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_par
 	return cc;
 }
 
-bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
-	ERR_FAIL_COND_V(space->locked, false);
-
+bool GodotPhysicsDirectSpaceState3D::_intersect_ray(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, RayResult &r_result, GodotCollisionObject3D **r_query_results, int *r_query_subindex_results) const {
 	Vector3 begin, end;
 	Vector3 normal;
-	begin = p_parameters.from;
-	end = p_parameters.to;
+	begin = p_from;
+	end = p_to;
 	normal = (end - begin).normalized();
 
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	int amount = space->broadphase->cull_segment(begin, end, r_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, r_query_subindex_results);
 
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
@@ -128,21 +127,21 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	real_t min_d = 1e10;
 
 	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(r_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.pick_ray && !(space->intersection_query_results[i]->is_ray_pickable())) {
+		if (p_parameters.pick_ray && !(r_query_results[i]->is_ray_pickable())) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(r_query_results[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject3D *col_obj = r_query_results[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = r_query_subindex_results[i];
 		Transform3D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
 		Vector3 local_from = inv_xform.xform(begin);
@@ -207,17 +206,16 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	return true;
 }
 
-int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
-	if (p_result_max <= 0) {
-		return 0;
-	}
+bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
+	ERR_FAIL_COND_V(space->locked, false);
 
-	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
-	ERR_FAIL_NULL_V(shape, 0);
+	return _intersect_ray(p_parameters, p_parameters.from, p_parameters.to, r_result, space->intersection_query_results, space->intersection_query_subindex_results);
+}
 
-	AABB aabb = p_parameters.transform.xform(shape->get_aabb());
+int GodotPhysicsDirectSpaceState3D::_intersect_shape(const ShapeParameters &p_parameters, const GodotShape3D *p_shape, const Transform3D &p_transform, ShapeResult *r_results, int p_result_max, GodotCollisionObject3D **r_query_results, int *r_query_subindex_results) const {
+	AABB aabb = p_transform.xform(p_shape->get_aabb());
 
-	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	int amount = space->broadphase->cull_aabb(aabb, r_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, r_query_subindex_results);
 
 	int cc = 0;
 
@@ -228,20 +226,20 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_par
 			break;
 		}
 
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(r_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
 		//area can't be picked by ray (default)
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(r_query_results[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
-		int shape_idx = space->intersection_query_subindex_results[i];
+		const GodotCollisionObject3D *col_obj = r_query_results[i];
+		int shape_idx = r_query_subindex_results[i];
 
-		if (!GodotCollisionSolver3D::solve_static(shape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), nullptr, nullptr, nullptr, p_parameters.margin, 0)) {
+		if (!GodotCollisionSolver3D::solve_static(p_shape, p_transform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), nullptr, nullptr, nullptr, p_parameters.margin, 0)) {
 			continue;
 		}
 
@@ -262,6 +260,104 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_par
 	return cc;
 }
 
+int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
+	if (p_result_max <= 0) {
+		return 0;
+	}
+
+	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_NULL_V(shape, 0);
+
+	return _intersect_shape(p_parameters, shape, p_parameters.transform, r_results, p_result_max, space->intersection_query_results, space->intersection_query_subindex_results);
+}
+
+void GodotPhysicsDirectSpaceState3D::_intersect_rays_threaded(uint32_t p_thread, const RayBatch *p_batch) {
+	const uint32_t from = p_thread * p_batch->count / p_batch->thread_count;
+	const uint32_t to = (p_thread + 1 == p_batch->thread_count) ? p_batch->count : ((p_thread + 1) * p_batch->count / p_batch->thread_count);
+
+	// The space's query buffers can't be shared between threads.
+	LocalVector<GodotCollisionObject3D *> query_results;
+	LocalVector<int> query_subindex_results;
+	query_results.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	query_subindex_results.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+
+	for (uint32_t i = from; i < to; i++) {
+		p_batch->hits[i] = _intersect_ray(*p_batch->parameters, p_batch->from[i], p_batch->to[i], p_batch->results[i], query_results.ptr(), query_subindex_results.ptr());
+	}
+}
+
+void GodotPhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) {
+	ERR_FAIL_COND(space->locked);
+
+	const uint32_t thread_count = MIN(WorkerThreadPool::get_singleton()->get_thread_count(), (uint32_t)p_count / BATCH_QUERIES_PER_THREAD_MIN);
+	if (thread_count <= 1) {
+		for (int i = 0; i < p_count; i++) {
+			r_hits[i] = _intersect_ray(p_parameters, p_from[i], p_to[i], r_results[i], space->intersection_query_results, space->intersection_query_subindex_results);
+		}
+		return;
+	}
+
+	RayBatch batch;
+	batch.parameters = &p_parameters;
+	batch.from = p_from;
+	batch.to = p_to;
+	batch.results = r_results;
+	batch.hits = r_hits;
+	batch.count = p_count;
+	batch.thread_count = thread_count;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState3D::_intersect_rays_threaded, &batch, thread_count, -1, true, SNAME("GodotPhysicsIntersectRays3D"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+void GodotPhysicsDirectSpaceState3D::_intersect_shapes_threaded(uint32_t p_thread, const ShapeBatch *p_batch) {
+	const uint32_t from = p_thread * p_batch->count / p_batch->thread_count;
+	const uint32_t to = (p_thread + 1 == p_batch->thread_count) ? p_batch->count : ((p_thread + 1) * p_batch->count / p_batch->thread_count);
+
+	// The space's query buffers can't be shared between threads.
+	LocalVector<GodotCollisionObject3D *> query_results;
+	LocalVector<int> query_subindex_results;
+	query_results.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	query_subindex_results.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+
+	for (uint32_t i = from; i < to; i++) {
+		p_batch->result_counts[i] = _intersect_shape(*p_batch->parameters, p_batch->shape, p_batch->transforms[i], p_batch->results + i * p_batch->result_max, p_batch->result_max, query_results.ptr(), query_subindex_results.ptr());
+	}
+}
+
+void GodotPhysicsDirectSpaceState3D::intersect_shapes(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	if (p_result_max <= 0) {
+		for (int i = 0; i < p_count; i++) {
+			r_result_counts[i] = 0;
+		}
+		return;
+	}
+
+	const GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_NULL(shape);
+
+	const uint32_t thread_count = MIN(WorkerThreadPool::get_singleton()->get_thread_count(), (uint32_t)p_count / BATCH_QUERIES_PER_THREAD_MIN);
+	if (thread_count <= 1) {
+		for (int i = 0; i < p_count; i++) {
+			r_result_counts[i] = _intersect_shape(p_parameters, shape, p_transforms[i], r_results + i * p_result_max, p_result_max, space->intersection_query_results, space->intersection_query_subindex_results);
+		}
+		return;
+	}
+
+	ShapeBatch batch;
+	batch.parameters = &p_parameters;
+	batch.shape = shape;
+	batch.transforms = p_transforms;
+	batch.results = r_results;
+	batch.result_max = p_result_max;
+	batch.result_counts = r_result_counts;
+	batch.count = p_count;
+	batch.thread_count = thread_count;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState3D::_intersect_shapes_threaded, &batch, thread_count, -1, true, SNAME("GodotPhysicsIntersectShapes3D"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info) {
 	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
 	ERR_FAIL_NULL_V(shape, false);
@@ -1252,6 +1348,52 @@ bool GodotSpace3D::is_locked() const {
 	return locked;
 }
 
+uint64_t GodotSpace3D::get_state_hash() const {
+	// Bodies are hashed separately and summed up, so the result doesn't depend on the order of the objects set.
+	// Each state is hashed along with properties that tell bodies apart, so states swapped between two bodies
+	// are only missed if the bodies have the same mode, layers and mass.
+	uint64_t state_hash = 0;
+
+	for (const GodotCollisionObject3D *object : objects) {
+		if (object->get_type() != GodotCollisionObject3D::TYPE_BODY) {
+			continue;
+		}
+
+		const GodotBody3D *body = static_cast<const GodotBody3D *>(object);
+		const Transform3D &transform = body->get_transform();
+		const Vector3 linear_velocity = body->get_linear_velocity();
+		const Vector3 angular_velocity = body->get_angular_velocity();
+
+		uint32_t key = hash_murmur3_one_32(body->get_mode());
+		key = hash_murmur3_one_32(body->get_collision_layer(), key);
+		key = hash_murmur3_one_32(body->get_collision_mask(), key);
+		key = hash_murmur3_one_real(body->get_inv_mass(), key);
+		key = hash_murmur3_one_32(body->is_active(), key);
+
+		real_t state[18];
+		for (int i = 0; i < 3; i++) {
+			state[i * 6 + 0] = transform.basis.rows[i].x;
+			state[i * 6 + 1] = transform.basis.rows[i].y;
+			state[i * 6 + 2] = transform.basis.rows[i].z;
+			state[i * 6 + 3] = transform.origin[i];
+			state[i * 6 + 4] = linear_velocity[i];
+			state[i * 6 + 5] = angular_velocity[i];
+		}
+
+		// Two hashes with different seeds make up 64 bits, so the sum isn't limited to 32 bits of collision resistance.
+		uint32_t low = hash_murmur3_one_32(key);
+		uint32_t high = hash_murmur3_one_32(key, ~HASH_MURMUR3_SEED);
+		for (const real_t value : state) {
+			low = hash_murmur3_one_real(value, low);
+			high = hash_murmur3_one_real(value, high);
+		}
+
+		state_hash += (uint64_t(hash_fmix32(high)) << 32) | hash_fmix32(low);
+	}
+
+	return state_hash;
+}
+
 GodotPhysicsDirectSpaceState3D *GodotSpace3D::get_direct_state() {
 	return direct_access;
 }
@@ -1265,6 +1407,7 @@ GodotSpace3D::GodotSpace3D() {
 	contact_max_separation = GLOBAL_GET("physics/3d/solver/contact_max_separation");
 	contact_max_allowed_penetration = GLOBAL_GET("physics/3d/solver/contact_max_allowed_penetration");
 	contact_bias = GLOBAL_GET("physics/3d/solver/default_contact_bias");
+	deterministic_simulation = GLOBAL_GET("physics/3d/solver/deterministic_simulation");
 
 	broadphase = GodotBroadPhase3D::create_func();
 	broadphase->set_pair_callback(_broadphase_pair, this);
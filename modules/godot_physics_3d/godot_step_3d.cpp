@@ -41,6 +41,12 @@
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
 
+// Islands with at least this many constraints are solved one color at a time, using several threads.
+#define COLORED_ISLAND_CONSTRAINT_MIN 1024
+// Constraints past this many colors go to a last batch, solved on a single thread.
+#define ISLAND_COLOR_MAX 64
+#define COLOR_BATCH_CHUNK_SIZE 64
+
 void GodotStep3D::_populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
 
@@ -117,6 +123,41 @@ void GodotStep3D::_setup_constraint(uint32_t p_constraint_index, void *p_userdat
 	constraint->setup(delta);
 }
 
+void GodotStep3D::_sort_island(LocalVector<GodotConstraint3D *> &p_constraint_island) {
+	// Constraints are found through hash maps keyed by pointers, so their order can change between runs and machines.
+	// Sort them by the objects they involve instead, which only depends on the order objects were created in.
+	solve_order.resize(p_constraint_island.size());
+	for (uint32_t constraint_index = 0; constraint_index < p_constraint_island.size(); ++constraint_index) {
+		GodotConstraint3D *constraint = p_constraint_island[constraint_index];
+		ConstraintSolveOrder &order = solve_order[constraint_index];
+		order.constraint = constraint;
+
+		const int body_count = MIN(constraint->get_body_count(), 2);
+		order.key[0] = body_count;
+		for (int i = 0; i < body_count; i++) {
+			order.key[1 + i * 2] = constraint->get_body_ptr()[i]->get_self().get_id();
+			order.key[2 + i * 2] = constraint->get_body_shape(i);
+		}
+		for (int i = body_count; i < 2; i++) {
+			order.key[1 + i * 2] = 0;
+			order.key[2 + i * 2] = 0;
+		}
+		if (body_count == 2 && (order.key[1] > order.key[3] || (order.key[1] == order.key[3] && order.key[2] > order.key[4]))) {
+			// Which body comes first depends on how the pair was found.
+			SWAP(order.key[1], order.key[3]);
+			SWAP(order.key[2], order.key[4]);
+		}
+		order.key[5] = constraint->get_soft_body_count() > 0 ? constraint->get_soft_body_ptr(0)->get_self().get_id() : 0;
+		order.key[6] = constraint->get_self().get_id();
+	}
+
+	solve_order.sort();
+
+	for (uint32_t constraint_index = 0; constraint_index < p_constraint_island.size(); ++constraint_index) {
+		p_constraint_island[constraint_index] = solve_order[constraint_index].constraint;
+	}
+}
+
 void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const {
 	uint32_t constraint_count = p_constraint_island.size();
 	uint32_t valid_constraint_count = 0;
@@ -130,8 +171,8 @@ void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constrai
 	p_constraint_island.resize(valid_constraint_count);
 }
 
-void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
-	LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[p_island_index];
+void GodotStep3D::_solve_island(uint32_t p_serial_island_index, void *p_userdata) {
+	LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[serial_islands[p_serial_island_index]];
 
 	int current_priority = 1;
 
@@ -158,6 +199,145 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	}
 }
 
+bool GodotStep3D::_can_color_island(const LocalVector<GodotConstraint3D *> &p_constraint_island) const {
+	if (p_constraint_island.size() < COLORED_ISLAND_CONSTRAINT_MIN) {
+		return false;
+	}
+
+#ifdef TESTS_ENABLED
+	if (!island_coloring_enabled) {
+		return false;
+	}
+#endif // TESTS_ENABLED
+
+	for (const GodotConstraint3D *constraint : p_constraint_island) {
+		if (constraint->get_soft_body_count() > 0) {
+			// Soft body constraints aren't tracked per body, keep them on a single thread.
+			return false;
+		}
+	}
+
+	return true;
+}
+
+uint32_t GodotStep3D::_color_island(const LocalVector<GodotConstraint3D *> &p_constraint_island) {
+	if (color_batches.size() < ISLAND_COLOR_MAX + 1) {
+		color_batches.resize(ISLAND_COLOR_MAX + 1);
+	}
+	for (LocalVector<GodotConstraint3D *> &batch : color_batches) {
+		batch.clear();
+	}
+	body_color_masks.clear();
+
+	// Greedy coloring in island order. Constraints only write to the dynamic bodies
+	// they involve, so those are the only ones that can't be shared within a color.
+	uint32_t color_count = 0;
+	for (GodotConstraint3D *constraint : p_constraint_island) {
+		GodotBody3D **bodies = constraint->get_body_ptr();
+		const int body_count = constraint->get_body_count();
+
+		uint64_t used_colors = 0;
+		for (int i = 0; i < body_count; i++) {
+			const uint64_t *body_colors = body_color_masks.getptr(bodies[i]);
+			if (body_colors) {
+				used_colors |= *body_colors;
+			}
+		}
+
+		if (used_colors == UINT64_MAX) {
+			color_batches[ISLAND_COLOR_MAX].push_back(constraint);
+			continue;
+		}
+
+		uint32_t color = 0;
+		while (used_colors & (uint64_t(1) << color)) {
+			color++;
+		}
+
+		for (int i = 0; i < body_count; i++) {
+			if (bodies[i]->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC) {
+				uint64_t *body_colors = body_color_masks.getptr(bodies[i]);
+				if (body_colors) {
+					*body_colors |= uint64_t(1) << color;
+				} else {
+					body_color_masks.insert(bodies[i], uint64_t(1) << color);
+				}
+			}
+		}
+
+		color_batches[color].push_back(constraint);
+		color_count = MAX(color_count, color + 1);
+	}
+
+	return color_count;
+}
+
+void GodotStep3D::_solve_constraint_batch(uint32_t p_chunk_index, const LocalVector<GodotConstraint3D *> *p_batch) {
+	const uint32_t from = p_chunk_index * COLOR_BATCH_CHUNK_SIZE;
+	const uint32_t to = MIN(from + COLOR_BATCH_CHUNK_SIZE, p_batch->size());
+	for (uint32_t constraint_index = from; constraint_index < to; ++constraint_index) {
+		(*p_batch)[constraint_index]->solve(delta);
+	}
+}
+
+void GodotStep3D::_solve_colored_island(LocalVector<GodotConstraint3D *> &p_constraint_island) {
+	const uint32_t color_count = _color_island(p_constraint_island);
+	const LocalVector<GodotConstraint3D *> &uncolored_batch = color_batches[ISLAND_COLOR_MAX];
+
+#ifdef TESTS_ENABLED
+	last_color_bodies.resize(color_count);
+	for (uint32_t color = 0; color < color_count; ++color) {
+		last_color_bodies[color].clear();
+		for (GodotConstraint3D *constraint : color_batches[color]) {
+			for (int i = 0; i < constraint->get_body_count(); i++) {
+				const GodotBody3D *body = constraint->get_body_ptr()[i];
+				if (body->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC) {
+					last_color_bodies[color].push_back(body);
+				}
+			}
+		}
+	}
+#endif // TESTS_ENABLED
+
+	int current_priority = 1;
+
+	bool has_constraints = true;
+	while (has_constraints) {
+		for (int i = 0; i < iterations; i++) {
+			// Go through all iterations, one color after the other.
+			for (uint32_t color = 0; color < color_count; ++color) {
+				const LocalVector<GodotConstraint3D *> *batch = &color_batches[color];
+				const uint32_t chunk_count = Math::division_round_up(batch->size(), (uint32_t)COLOR_BATCH_CHUNK_SIZE);
+				if (chunk_count > 1) {
+					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_constraint_batch, batch, chunk_count, -1, true, SNAME("Physics3DConstraintSolveColor"));
+					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+				} else if (chunk_count == 1) {
+					_solve_constraint_batch(0, batch);
+				}
+			}
+			for (uint32_t constraint_index = 0; constraint_index < uncolored_batch.size(); ++constraint_index) {
+				uncolored_batch[constraint_index]->solve(delta);
+			}
+		}
+
+		// Check priority to keep only higher priority constraints.
+		++current_priority;
+		has_constraints = false;
+		for (LocalVector<GodotConstraint3D *> &batch : color_batches) {
+			uint32_t priority_constraint_count = 0;
+			for (uint32_t constraint_index = 0; constraint_index < batch.size(); ++constraint_index) {
+				GodotConstraint3D *constraint = batch[constraint_index];
+				if (constraint->get_priority() >= current_priority) {
+					// Keep this constraint for the next iteration.
+					batch[priority_constraint_count++] = constraint;
+				}
+			}
+			batch.resize(priority_constraint_count);
+			has_constraints = has_constraints || priority_constraint_count > 0;
+		}
+	}
+}
+
 void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const {
 	bool can_sleep = true;
 
@@ -356,15 +536,33 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	/* PRE-SOLVE CONSTRAINT ISLANDS */
 
 	// WARNING: This doesn't run on threads, because it involves thread-unsafe processing.
+	serial_islands.clear();
+	colored_islands.clear();
 	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
+		if (p_space->is_deterministic_simulation()) {
+			_sort_island(constraint_islands[island_index]);
+		}
+
 		_pre_solve_island(constraint_islands[island_index]);
+
+		if (_can_color_island(constraint_islands[island_index])) {
+			colored_islands.push_back(island_index);
+		} else {
+			serial_islands.push_back(island_index);
+		}
 	}
 
 	/* SOLVE CONSTRAINT ISLANDS */
 
-	// WARNING: `_solve_island` modifies the constraint islands for optimization purpose,
+	// WARNING: `_solve_island` and `_solve_colored_island` modify the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
-	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, serial_islands.size(), -1, true, SNAME("Physics3DConstraintSolveIslands"));
+
+	// Large islands would hold back a single thread, so their colors are spread across threads instead.
+	for (uint32_t island_index : colored_islands) {
+		_solve_colored_island(constraint_islands[island_index]);
+	}
+
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -32,6 +32,7 @@
 
 #include "godot_space_3d.h"
 
+#include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
 
 class GodotStep3D {
@@ -44,15 +45,57 @@ class GodotStep3D {
 	LocalVector<LocalVector<GodotConstraint3D *>> constraint_islands;
 	LocalVector<GodotConstraint3D *> all_constraints;
 
+	// Islands solved as a whole on a single thread.
+	LocalVector<uint32_t> serial_islands;
+	// Large islands, split into batches of constraints not sharing any dynamic body, which are solved in parallel.
+	LocalVector<uint32_t> colored_islands;
+	LocalVector<LocalVector<GodotConstraint3D *>> color_batches;
+	HashMap<const GodotBody3D *, uint64_t> body_color_masks;
+
+	struct ConstraintSolveOrder {
+		// Body count, then (RID, shape) of each body, soft body RID and constraint RID.
+		uint64_t key[7] = {};
+		GodotConstraint3D *constraint = nullptr;
+
+		bool operator<(const ConstraintSolveOrder &p_other) const {
+			for (int i = 0; i < 7; i++) {
+				if (key[i] != p_other.key[i]) {
+					return key[i] < p_other.key[i];
+				}
+			}
+			return false;
+		}
+	};
+	LocalVector<ConstraintSolveOrder> solve_order;
+
+#ifdef TESTS_ENABLED
+	// Lets tests solve large islands serially, and check the colors of the last colored island.
+	bool island_coloring_enabled = true;
+	LocalVector<LocalVector<const GodotBody3D *>> last_color_bodies;
+#endif // TESTS_ENABLED
+
 	void _populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
+	void _sort_island(LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const;
-	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
+	void _solve_island(uint32_t p_serial_island_index, void *p_userdata = nullptr);
+	bool _can_color_island(const LocalVector<GodotConstraint3D *> &p_constraint_island) const;
+	uint32_t _color_island(const LocalVector<GodotConstraint3D *> &p_constraint_island);
+	void _solve_constraint_batch(uint32_t p_chunk_index, const LocalVector<GodotConstraint3D *> *p_batch);
+	void _solve_colored_island(LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
 
 public:
 	void step(GodotSpace3D *p_space, real_t p_delta);
+
+#ifdef TESTS_ENABLED
+	void set_island_coloring_enabled(bool p_enabled) { island_coloring_enabled = p_enabled; }
+	uint32_t get_colored_island_count() const { return colored_islands.size(); }
+	// Dynamic bodies of the constraints in each color, repeated once per constraint.
+	const LocalVector<LocalVector<const GodotBody3D *>> &get_last_color_bodies() const { return last_color_bodies; }
+#endif // TESTS_ENABLED
+
 	GodotStep3D();
 	~GodotStep3D();
 };
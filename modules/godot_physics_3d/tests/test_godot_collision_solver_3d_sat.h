@@ -0,0 +1,112 @@
+/**************************************************************************/
+/*  test_godot_collision_solver_3d_sat.h                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_collision_solver_3d_sat.h"
+#include "../godot_shape_3d.h"
+
+#include "core/math/random_pcg.h"
+#include "tests/test_macros.h"
+
+namespace TestGodotCollisionSolver3DSAT {
+
+struct SATContact {
+	Vector3 point_A;
+	Vector3 point_B;
+	Vector3 normal;
+};
+
+static void _add_sat_contact(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &p_normal, void *p_userdata) {
+	static_cast<LocalVector<SATContact> *>(p_userdata)->push_back({ p_point_A, p_point_B, p_normal });
+}
+
+static Transform3D _random_box_transform(RandomPCG &p_rng, const Basis &p_shared_basis) {
+	Basis basis;
+	switch (p_rng.rand() % 4) {
+		case 0: {
+			// Parallel edges, whose cross products are skipped.
+			basis = p_shared_basis;
+		} break;
+		case 1: {
+			// Axis-aligned.
+		} break;
+		default: {
+			basis = Basis::from_euler(Vector3(p_rng.random(-Math::PI, Math::PI), p_rng.random(-Math::PI, Math::PI), p_rng.random(-Math::PI, Math::PI)));
+		} break;
+	}
+	return Transform3D(basis, Vector3(p_rng.random(-2.0, 2.0), p_rng.random(-2.0, 2.0), p_rng.random(-2.0, 2.0)));
+}
+
+TEST_CASE("[GodotPhysics3D] Box-box axes tested in batches match axes tested one by one") {
+	RandomPCG rng(20260501);
+	const Basis shared_basis = Basis::from_euler(Vector3(0.3, -1.1, 0.7));
+
+	GodotBoxShape3D box_A;
+	GodotBoxShape3D box_B;
+
+	int collided_count = 0;
+	for (int i = 0; i < 2000; i++) {
+		box_A.set_data(Vector3(rng.random(0.1, 1.5), rng.random(0.1, 1.5), rng.random(0.1, 1.5)));
+		box_B.set_data(Vector3(rng.random(0.1, 1.5), rng.random(0.1, 1.5), rng.random(0.1, 1.5)));
+		const Transform3D transform_A = _random_box_transform(rng, shared_basis);
+		const Transform3D transform_B = _random_box_transform(rng, shared_basis);
+		// Margins take the extra vertex and edge tests.
+		const real_t margin = (i % 2) ? rng.random(0.01, 0.1) : 0.0;
+
+		LocalVector<SATContact> batched_contacts;
+		Vector3 batched_axis;
+		const bool batched_collided = sat_calculate_penetration(&box_A, transform_A, &box_B, transform_B, _add_sat_contact, &batched_contacts, false, &batched_axis, margin, margin);
+
+		LocalVector<SATContact> single_contacts;
+		Vector3 single_axis;
+		const bool single_collided = sat_calculate_penetration_box_box_single_axes(&box_A, transform_A, &box_B, transform_B, _add_sat_contact, &single_contacts, &single_axis, margin, margin);
+
+		INFO(vformat("Pair %d: %s (%s) and %s (%s), margin %f.", i, box_A.get_half_extents(), transform_A, box_B.get_half_extents(), transform_B, margin));
+		REQUIRE(batched_collided == single_collided);
+		CHECK(batched_axis.is_equal_approx(single_axis));
+		REQUIRE(batched_contacts.size() == single_contacts.size());
+		for (uint32_t j = 0; j < batched_contacts.size(); j++) {
+			CHECK(batched_contacts[j].point_A.is_equal_approx(single_contacts[j].point_A));
+			CHECK(batched_contacts[j].point_B.is_equal_approx(single_contacts[j].point_B));
+			CHECK(batched_contacts[j].normal.is_equal_approx(single_contacts[j].normal));
+		}
+
+		if (batched_collided) {
+			collided_count++;
+		}
+	}
+
+	// Both separated and colliding pairs were compared.
+	CHECK(collided_count > 100);
+	CHECK(collided_count < 1900);
+}
+
+} // namespace TestGodotCollisionSolver3DSAT
@@ -0,0 +1,128 @@
+/**************************************************************************/
+/*  test_godot_step_3d.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_physics_server_3d.h"
+#include "../godot_step_3d.h"
+
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/hash_set.h"
+#include "tests/test_macros.h"
+
+namespace TestGodotStep3D {
+
+// Side of a grid of boxes resting on a floor and pressed against their neighbors,
+// which gives a single island with more constraints than needed for coloring.
+static constexpr int BOX_GRID_SIZE = 24;
+
+static LocalVector<Vector3> _step_box_grid(GodotPhysicsServer3D *p_server, bool p_island_coloring, uint32_t &r_colored_island_count) {
+	p_server->get_stepper()->set_island_coloring_enabled(p_island_coloring);
+
+	RID space = p_server->space_create();
+	p_server->space_set_active(space, true);
+
+	RID box = p_server->box_shape_create();
+	p_server->shape_set_data(box, Vector3(0.5, 0.5, 0.5));
+	RID floor_shape = p_server->box_shape_create();
+	p_server->shape_set_data(floor_shape, Vector3(BOX_GRID_SIZE, 0.5, BOX_GRID_SIZE));
+
+	RID floor = p_server->body_create();
+	p_server->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	p_server->body_add_shape(floor, floor_shape);
+	p_server->body_set_state(floor, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, -0.5, 0)));
+	p_server->body_set_space(floor, space);
+
+	LocalVector<RID> bodies;
+	for (int x = 0; x < BOX_GRID_SIZE; x++) {
+		for (int z = 0; z < BOX_GRID_SIZE; z++) {
+			RID body = p_server->body_create();
+			p_server->body_add_shape(body, box);
+			p_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(x * 0.98, 0.49, z * 0.98)));
+			p_server->body_set_space(body, space);
+			bodies.push_back(body);
+		}
+	}
+
+	r_colored_island_count = 0;
+	for (int i = 0; i < 10; i++) {
+		p_server->step(1.0 / 60.0);
+		p_server->flush_queries();
+		r_colored_island_count = MAX(r_colored_island_count, p_server->get_stepper()->get_colored_island_count());
+	}
+
+	LocalVector<Vector3> positions;
+	for (const RID &body : bodies) {
+		positions.push_back(Transform3D(p_server->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin);
+		p_server->free_rid(body);
+	}
+	p_server->free_rid(floor);
+	p_server->free_rid(floor_shape);
+	p_server->free_rid(box);
+	p_server->free_rid(space);
+
+	p_server->get_stepper()->set_island_coloring_enabled(true);
+
+	return positions;
+}
+
+TEST_CASE("[SceneTree][GodotPhysics3D] Large islands solved by color match serial solving") {
+	GodotPhysicsServer3D *server = GodotPhysicsServer3D::get_godot_singleton();
+	REQUIRE(server != nullptr);
+	// Colors are solved with group tasks, which only run in parallel with several threads.
+	WARN(WorkerThreadPool::get_singleton()->get_thread_count() > 1);
+
+	uint32_t colored_island_count = 0;
+	const LocalVector<Vector3> colored_positions = _step_box_grid(server, true, colored_island_count);
+	CHECK(colored_island_count > 0);
+
+	// No dynamic body can be written to by two constraints solved in parallel.
+	const LocalVector<LocalVector<const GodotBody3D *>> &color_bodies = server->get_stepper()->get_last_color_bodies();
+	CHECK(color_bodies.size() > 1);
+	for (uint32_t color = 0; color < color_bodies.size(); color++) {
+		HashSet<const GodotBody3D *> seen;
+		for (const GodotBody3D *body : color_bodies[color]) {
+			CHECK_MESSAGE(!seen.has(body), vformat("A body is used by two constraints of color %d.", color));
+			seen.insert(body);
+		}
+	}
+
+	uint32_t serial_colored_island_count = 0;
+	const LocalVector<Vector3> serial_positions = _step_box_grid(server, false, serial_colored_island_count);
+	CHECK(serial_colored_island_count == 0);
+
+	// Solving by color changes the order of constraints, so results are close but not identical.
+	REQUIRE(colored_positions.size() == serial_positions.size());
+	for (uint32_t i = 0; i < colored_positions.size(); i++) {
+		CHECK_MESSAGE(colored_positions[i].distance_to(serial_positions[i]) < 0.02, vformat("Box %d: %s (colored) and %s (serial).", i, colored_positions[i], serial_positions[i]));
+	}
+}
+
+} // namespace TestGodotStep3D
@@ -34,6 +34,7 @@
 #include "../jolt_physics_server_3d.h"
 #include "../jolt_project_settings.h"
 #include "../misc/jolt_stream_wrappers.h"
+#include "../misc/jolt_type_conversions.h"
 #include "../objects/jolt_area_3d.h"
 #include "../objects/jolt_body_3d.h"
 #include "../shapes/jolt_custom_shape_type.h"
@@ -377,6 +378,62 @@ JoltSoftBody3D *JoltSpace3D::try_get_soft_body(const JPH::BodyID &p_body_id) con
 	return object->as_soft_body();
 }
 
+uint64_t JoltSpace3D::get_state_hash() const {
+	JPH::BodyIDVector body_ids;
+	physics_system->GetBodies(body_ids);
+
+	const JPH::BodyLockInterface &lock_iface = get_lock_iface();
+
+	// Bodies are hashed separately and summed up, so the result doesn't depend on their IDs.
+	// Each state is hashed along with properties that tell bodies apart, so states swapped between two bodies
+	// are only missed if the bodies have the same mode, layers and mass.
+	uint64_t state_hash = 0;
+
+	for (const JPH::BodyID &body_id : body_ids) {
+		const JPH::Body *jolt_body = lock_iface.TryGetBody(body_id);
+		if (jolt_body == nullptr || !jolt_body->IsRigidBody()) {
+			continue;
+		}
+
+		// Areas are sensor rigid bodies in Jolt, so the object has to be checked as well.
+		const JoltObject3D *object = reinterpret_cast<const JoltObject3D *>(jolt_body->GetUserData());
+		const JoltBody3D *body = object != nullptr ? object->as_body() : nullptr;
+		if (body == nullptr) {
+			continue;
+		}
+
+		const Vector3 position = to_godot(jolt_body->GetPosition());
+		const JPH::Quat rotation = jolt_body->GetRotation();
+		const Vector3 linear_velocity = to_godot(jolt_body->GetLinearVelocity());
+		const Vector3 angular_velocity = to_godot(jolt_body->GetAngularVelocity());
+
+		uint32_t key = hash_murmur3_one_32(body->get_mode());
+		key = hash_murmur3_one_32(body->get_collision_layer(), key);
+		key = hash_murmur3_one_32(body->get_collision_mask(), key);
+		key = hash_murmur3_one_float(body->get_mass(), key);
+		key = hash_murmur3_one_32(jolt_body->IsActive(), key);
+
+		const real_t state[13] = {
+			position.x, position.y, position.z,
+			rotation.GetX(), rotation.GetY(), rotation.GetZ(), rotation.GetW(),
+			linear_velocity.x, linear_velocity.y, linear_velocity.z,
+			angular_velocity.x, angular_velocity.y, angular_velocity.z
+		};
+
+		// Two hashes with different seeds make up 64 bits, so the sum isn't limited to 32 bits of collision resistance.
+		uint32_t low = hash_murmur3_one_32(key);
+		uint32_t high = hash_murmur3_one_32(key, ~HASH_MURMUR3_SEED);
+		for (const real_t value : state) {
+			low = hash_murmur3_one_real(value, low);
+			high = hash_murmur3_one_real(value, high);
+		}
+
+		state_hash += (uint64_t(hash_fmix32(high)) << 32) | hash_fmix32(low);
+	}
+
+	return state_hash;
+}
+
 JoltPhysicsDirectSpaceState3D *JoltSpace3D::get_direct_state() {
 	if (direct_state == nullptr) {
 		direct_state = memnew(JoltPhysicsDirectSpaceState3D(this));
@@ -126,6 +126,8 @@ public:
 
 	JoltPhysicsDirectSpaceState3D *get_direct_state();
 
+	uint64_t get_state_hash() const;
+
 	JoltArea3D *get_default_area() const { return default_area; }
 	void set_default_area(JoltArea3D *p_area) { default_area = p_area; }
 
@@ -113,6 +113,15 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
+	// Reading a global transform cleans the node and all its ancestors, so a dirty node only has dirty
+	// descendants. If the change was already propagated to this subtree since notifications were last
+	// flushed (and nothing affecting propagation changed), all of it is dirty and queued already.
+	// Skipping it turns moving many nodes under a common parent within a frame from quadratic into linear.
+	const uint32_t global_dirty_bits = DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM;
+	if (data.xform_change_epoch.get() == get_tree()->xform_change_epoch.get() && (_read_dirty_mask() & global_dirty_bits) == global_dirty_bits) {
+		return;
+	}
+
 	for (uint32_t n = 0; n < data.node3d_children.size(); n++) {
 		Node3D *s = data.node3d_children[n];
 
@@ -135,7 +144,14 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 			callable_mp(this, &Node3D::_propagate_transform_changed_deferred).call_deferred();
 		}
 	}
-	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM);
+	_set_dirty_bits(global_dirty_bits);
+	data.xform_change_epoch.set(get_tree()->xform_change_epoch.get());
+}
+
+void Node3D::_invalidate_transform_propagation() {
+	if (is_inside_tree()) {
+		get_tree()->xform_change_epoch.increment();
+	}
 }
 
 void Node3D::_notification(int p_what) {
@@ -177,6 +193,7 @@ void Node3D::_notification(int p_what) {
 
 			_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM); // Global is always dirty upon entering a scene.
 			_notify_dirty();
+			_invalidate_transform_propagation(); // The parent subtree gained a node that wasn't propagated to.
 
 			notification(NOTIFICATION_ENTER_WORLD);
 			_update_visibility_parent(true);
@@ -920,6 +937,7 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		return;
 	}
 	data.gizmos.push_back(p_gizmo);
+	_invalidate_transform_propagation();
 
 	if (p_gizmo.is_valid() && is_inside_world()) {
 		p_gizmo->create();
@@ -1060,6 +1078,7 @@ void Node3D::set_as_top_level(bool p_enabled) {
 		}
 	}
 	data.top_level = p_enabled;
+	_invalidate_transform_propagation();
 	reset_physics_interpolation();
 }
 
@@ -1069,6 +1088,7 @@ void Node3D::set_as_top_level_keep_local(bool p_enabled) {
 		return;
 	}
 	data.top_level = p_enabled;
+	_invalidate_transform_propagation();
 	_propagate_transform_changed(this);
 	reset_physics_interpolation();
 }
@@ -1279,6 +1299,7 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 void Node3D::set_notify_transform(bool p_enabled) {
 	ERR_THREAD_GUARD;
 	data.notify_transform = p_enabled;
+	_invalidate_transform_propagation();
 }
 
 bool Node3D::is_transform_notification_enabled() const {
@@ -1303,6 +1324,7 @@ void Node3D::force_update_transform() {
 		return; //nothing to update
 	}
 	get_tree()->xform_change_list.remove(&xform_change);
+	_invalidate_transform_propagation();
 
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
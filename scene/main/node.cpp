@@ -131,7 +131,7 @@ void Node::_notification(int p_notification) {
 			}
 
 			{ // Update threaded process mode.
-				if (data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
+				if (!_owns_process_thread_group()) {
 					if (data.parent) {
 						data.process_thread_group_owner = data.parent->data.process_thread_group_owner;
 					}
@@ -1090,7 +1090,7 @@ void Node::_remove_tree_from_process_thread_group() {
 	}
 
 	for (KeyValue<StringName, Node *> &K : data.children) {
-		if (K.value->data.process_thread_group != PROCESS_THREAD_GROUP_INHERIT) {
+		if (K.value->_owns_process_thread_group()) {
 			continue;
 		}
 
@@ -1115,13 +1115,35 @@ void Node::_add_tree_to_process_thread_group(Node *p_owner) {
 	}
 
 	for (KeyValue<StringName, Node *> &K : data.children) {
-		if (K.value->data.process_thread_group != PROCESS_THREAD_GROUP_INHERIT) {
+		if (K.value->_owns_process_thread_group()) {
 			continue;
 		}
 
 		K.value->_add_tree_to_process_thread_group(p_owner);
 	}
 }
+
+void Node::_remove_child_process_groups() {
+	for (KeyValue<StringName, Node *> &K : data.children) {
+		if (K.value->data.process_thread_group != PROCESS_THREAD_GROUP_INHERIT) {
+			continue;
+		}
+
+		K.value->_remove_tree_from_process_thread_group();
+		K.value->_remove_process_group();
+	}
+}
+
+void Node::_add_child_process_groups() {
+	for (KeyValue<StringName, Node *> &K : data.children) {
+		if (K.value->data.process_thread_group != PROCESS_THREAD_GROUP_INHERIT) {
+			continue;
+		}
+
+		K.value->_add_process_group();
+		K.value->_add_tree_to_process_thread_group(K.value);
+	}
+}
 bool Node::is_processing_internal() const {
 	return data.process_internal;
 }
@@ -1211,13 +1233,16 @@ void Node::set_process_thread_group(ProcessThreadGroup p_mode) {
 	}
 
 	_remove_tree_from_process_thread_group();
-	if (data.process_thread_group != PROCESS_THREAD_GROUP_INHERIT) {
+	if (data.process_thread_group == PROCESS_THREAD_GROUP_SUB_THREAD_PER_CHILD) {
+		_remove_child_process_groups();
+	}
+	if (data.process_thread_group_owner == this) {
 		_remove_process_group();
 	}
 
 	data.process_thread_group = p_mode;
 
-	if (p_mode == PROCESS_THREAD_GROUP_INHERIT) {
+	if (!_owns_process_thread_group()) {
 		if (data.parent) {
 			data.process_thread_group_owner = data.parent->data.process_thread_group_owner;
 		} else {
@@ -1229,6 +1254,9 @@ void Node::set_process_thread_group(ProcessThreadGroup p_mode) {
 	}
 
 	_add_tree_to_process_thread_group(data.process_thread_group_owner);
+	if (p_mode == PROCESS_THREAD_GROUP_SUB_THREAD_PER_CHILD) {
+		_add_child_process_groups();
+	}
 
 	notify_property_list_changed();
 }
@@ -3972,6 +4000,7 @@ void Node::_bind_methods() {
 	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_INHERIT);
 	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_MAIN_THREAD);
 	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_SUB_THREAD);
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_SUB_THREAD_PER_CHILD);
 
 	BIND_BITFIELD_FLAG(FLAG_PROCESS_THREAD_MESSAGES);
 	BIND_BITFIELD_FLAG(FLAG_PROCESS_THREAD_MESSAGES_PHYSICS);
@@ -4021,7 +4050,7 @@ void Node::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_physics_priority"), "set_physics_process_priority", "get_physics_process_priority");
 
 	ADD_SUBGROUP("Thread Group", "process_thread");
-	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Inherit,Main Thread,Sub Thread"), "set_process_thread_group", "get_process_thread_group");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Inherit,Main Thread,Sub Thread,Sub Thread Per Child"), "set_process_thread_group", "get_process_thread_group");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group_order"), "set_process_thread_group_order", "get_process_thread_group_order");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_messages", PROPERTY_HINT_FLAGS, "Process,Physics Process"), "set_process_thread_messages", "get_process_thread_messages");
 
@@ -85,6 +85,7 @@ public:
 		PROCESS_THREAD_GROUP_INHERIT,
 		PROCESS_THREAD_GROUP_MAIN_THREAD,
 		PROCESS_THREAD_GROUP_SUB_THREAD,
+		PROCESS_THREAD_GROUP_SUB_THREAD_PER_CHILD,
 	};
 
 	enum ProcessThreadMessages {
@@ -355,6 +356,23 @@ private:
 	void _remove_from_process_thread_group();
 	void _remove_tree_from_process_thread_group();
 	void _add_tree_to_process_thread_group(Node *p_owner);
+	void _remove_child_process_groups();
+	void _add_child_process_groups();
+
+	// Children set to inherit still get a group of their own under a parent processing them per child.
+	_FORCE_INLINE_ bool _owns_process_thread_group() const {
+		return data.process_thread_group != PROCESS_THREAD_GROUP_INHERIT || (data.parent && data.parent->data.process_thread_group == PROCESS_THREAD_GROUP_SUB_THREAD_PER_CHILD);
+	}
+
+	// The node whose thread group settings apply to the group owned by this node.
+	_FORCE_INLINE_ const Node *_get_process_thread_group_settings() const {
+		return data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT ? data.parent : this;
+	}
+
+	_FORCE_INLINE_ bool _is_process_thread_group_threaded() const {
+		const ProcessThreadGroup mode = _get_process_thread_group_settings()->data.process_thread_group;
+		return mode == PROCESS_THREAD_GROUP_SUB_THREAD || mode == PROCESS_THREAD_GROUP_SUB_THREAD_PER_CHILD;
+	}
 
 	static thread_local Node *current_process_thread_group;
 
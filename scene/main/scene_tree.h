@@ -256,6 +256,9 @@ private:
 	friend class Viewport;
 
 	SelfList<Node>::List xform_change_list;
+	// Changes whenever queued transform notifications are flushed, or a Node3D subtree changes
+	// in a way that affects propagation. See `Node3D::_propagate_transform_changed()`.
+	SafeNumeric<uint64_t> xform_change_epoch{ 1 };
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -152,6 +152,34 @@ static Node *_find_node_by_id(Node *p_owner, Node *p_node, int32_t p_id) {
 	return nullptr;
 }
 
+void SceneState::_update_setter_cache() const {
+	const uint32_t version = ClassDB::get_property_setget_version();
+	if (setter_cache_version == version) {
+		return;
+	}
+
+	setter_cache.clear();
+	setter_cache_offsets.resize(nodes.size());
+
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		setter_cache_offsets[i] = setter_cache.size();
+
+		// Only nodes created from their own type are known to be of that class.
+		const bool created_from_type = n.type >= 0 && n.type < names.size() && n.instance < 0 && (i > 0 || base_scene_idx < 0);
+
+		for (const NodeData::Property &prop : n.properties) {
+			const ClassDB::PropertySetGet *psg = nullptr;
+			if (created_from_type && !(prop.name & FLAG_PATH_PROPERTY_IS_NODE) && prop.name < names.size()) {
+				psg = ClassDB::get_property_setget(names[n.type], names[prop.name]);
+			}
+			setter_cache.push_back(psg);
+		}
+	}
+
+	setter_cache_version = version;
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -188,6 +216,11 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	const NodeData *nd = &nodes[0];
 
+	{
+		MutexLock lock(setter_cache_mutex);
+		_update_setter_cache();
+	}
+
 	Node **ret_nodes = (Node **)alloca(sizeof(Node *) * nc);
 	ret_nodes[0] = nullptr; // Sidesteps "maybe uninitialized" false-positives on GCC.
 
@@ -366,6 +399,12 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			if (nprop_count) {
 				const NodeData::Property *nprops = &n.properties[0];
 
+				// Cached setters can only be used if the class wasn't replaced by a placeholder.
+				const ClassDB::PropertySetGet *const *nsetters = nullptr;
+				if (n.type != TYPE_INSTANTIATED && !missing_node && node->get_class_name() == snames[n.type]) {
+					nsetters = &setter_cache[setter_cache_offsets[i]];
+				}
+
 				Dictionary missing_resource_properties;
 
 				for (int j = 0; j < nprop_count; j++) {
@@ -491,7 +530,12 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							const ClassDB::PropertySetGet *psg = nsetters ? nsetters[j] : nullptr;
+							if (psg && !node->get_script_instance() && !node->_get_extension()) {
+								ClassDB::call_property_setter(node, psg, value, &valid);
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 						if (p_edit_state == GEN_EDIT_STATE_INSTANCE && value.get_type() != Variant::OBJECT) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor.
@@ -1445,6 +1489,7 @@ void SceneState::clear() {
 	ids.clear();
 	id_paths.clear();
 	base_scene_idx = -1;
+	setter_cache_version = 0;
 }
 
 Error SceneState::copy_from(const Ref<SceneState> &p_scene_state) {
@@ -1700,6 +1745,7 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 		variants.clear();
 	}
 
+	setter_cache_version = 0;
 	nodes.resize(node_count);
 	if (node_count) {
 		const int *r = snodes.ptr();
@@ -2322,6 +2368,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.index = p_index;
 
 	nodes.push_back(nd);
+	setter_cache_version = 0;
 
 	ids.push_back(p_unique_id);
 
@@ -2340,6 +2387,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 	}
 	prop.value = p_value;
 	nodes.write[p_node].properties.push_back(prop);
+	setter_cache_version = 0;
 }
 
 void SceneState::add_node_group(int p_node, int p_group) {
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/object/class_db.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -90,6 +91,15 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Native setters of the node properties, resolved once instead of on every instantiate().
+	// Entries of node `i` start at `setter_cache_offsets[i]`, and are null where Object::set() must be used.
+	mutable BinaryMutex setter_cache_mutex;
+	mutable uint32_t setter_cache_version = 0;
+	mutable LocalVector<const ClassDB::PropertySetGet *> setter_cache;
+	mutable LocalVector<uint32_t> setter_cache_offsets;
+
+	void _update_setter_cache() const;
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map, HashSet<int32_t> &ids_saved);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
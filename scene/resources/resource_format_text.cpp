@@ -187,6 +187,19 @@ Ref<PackedScene> ResourceLoaderText::_parse_node_tag(VariantParser::ResourcePars
 		packed_scene.instantiate();
 	}
 
+	// Types and property names repeat across nodes, so each is only added to the state once.
+	// Node, group, signal and method names are not shared, as some of them may be renamed later.
+	HashMap<StringName, int> shared_names;
+	const auto add_shared_name = [&](const StringName &p_name) -> int {
+		int *idx = shared_names.getptr(p_name);
+		if (idx) {
+			return *idx;
+		}
+		const int new_idx = packed_scene->get_state()->add_name(p_name);
+		shared_names.insert(p_name, new_idx);
+		return new_idx;
+	};
+
 	while (true) {
 		if (next_tag.name == "node") {
 			int parent = -1;
@@ -217,7 +230,7 @@ Ref<PackedScene> ResourceLoaderText::_parse_node_tag(VariantParser::ResourcePars
 			}
 
 			if (next_tag.fields.has("type")) {
-				type = packed_scene->get_state()->add_name(next_tag.fields["type"]);
+				type = add_shared_name(next_tag.fields["type"]);
 			} else {
 				type = SceneState::TYPE_INSTANTIATED; //no type? assume this was instantiated
 			}
@@ -300,7 +313,7 @@ Ref<PackedScene> ResourceLoaderText::_parse_node_tag(VariantParser::ResourcePars
 
 				if (!assign.is_empty()) {
 					StringName assign_name = assign;
-					int nameidx = packed_scene->get_state()->add_name(assign_name);
+					int nameidx = add_shared_name(assign_name);
 					int valueidx = packed_scene->get_state()->add_value(value);
 					packed_scene->get_state()->add_node_property(node_id, nameidx, valueidx, path_properties.has(assign_name));
 					//it's assignment
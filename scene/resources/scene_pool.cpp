@@ -0,0 +1,383 @@
+/**************************************************************************/
+/*  scene_pool.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_pool.h"
+
+#include "core/object/callable_mp.h"
+#include "scene/main/scene_tree.h"
+
+SafeNumeric<uint64_t> ScenePool::total_hit_count;
+SafeNumeric<uint64_t> ScenePool::total_miss_count;
+SafeNumeric<uint64_t> ScenePool::total_available_count;
+
+bool ScenePool::_has_instance_objects(const Variant &p_value) {
+	switch (p_value.get_type()) {
+		case Variant::OBJECT: {
+			// Resources local to scene are unique to each instance, other objects such as nodes belong to it.
+			const Object *object = p_value.get_validated_object();
+			if (!object) {
+				return false;
+			}
+			const Resource *res = Object::cast_to<Resource>(object);
+			return !res || res->is_local_to_scene();
+		}
+		case Variant::ARRAY: {
+			const Array array = p_value;
+			for (const Variant &value : array) {
+				if (_has_instance_objects(value)) {
+					return true;
+				}
+			}
+			return false;
+		}
+		case Variant::DICTIONARY: {
+			const Dictionary dictionary = p_value;
+			for (const KeyValue<Variant, Variant> &kv : dictionary) {
+				if (_has_instance_objects(kv.key) || _has_instance_objects(kv.value)) {
+					return true;
+				}
+			}
+			return false;
+		}
+		default: {
+			return false;
+		}
+	}
+}
+
+Node *ScenePool::_instantiate() {
+	ERR_FAIL_COND_V_MSG(scene.is_null(), nullptr, "No scene set for the pool.");
+
+	Node *node = scene->instantiate();
+	ERR_FAIL_NULL_V(node, nullptr);
+
+	if (!defaults_valid) {
+		_record_defaults(node);
+		defaults_valid = true;
+	}
+
+	return node;
+}
+
+void ScenePool::_record_defaults(Node *p_root) {
+	defaults.clear();
+
+	LocalVector<Node *> stack;
+	stack.push_back(p_root);
+	while (!stack.is_empty()) {
+		Node *node = stack[stack.size() - 1];
+		stack.resize(stack.size() - 1);
+
+		NodeDefaults nd;
+		nd.path = p_root->get_path_to(node);
+
+		List<PropertyInfo> plist;
+		node->get_property_list(&plist);
+		for (const PropertyInfo &pi : plist) {
+			if (!(pi.usage & (PROPERTY_USAGE_STORAGE | PROPERTY_USAGE_SCRIPT_VARIABLE)) || pi.name == CoreStringName(script)) {
+				continue;
+			}
+
+			PropertyDefault pd;
+			pd.name = pi.name;
+			pd.value = node->get(pi.name);
+			if (_has_instance_objects(pd.value)) {
+				// Values pointing into this instance can't be shared with other instances.
+				// Nodes of the instance are stored as paths and found again in each instance, other values are left as they are.
+				Node *target = Object::cast_to<Node>(pd.value.get_validated_object());
+				if (!target || (target != p_root && !p_root->is_ancestor_of(target))) {
+					continue;
+				}
+				pd.value = node->get_path_to(target);
+				pd.is_node_reference = true;
+			} else if (pd.value.get_type() == Variant::ARRAY || pd.value.get_type() == Variant::DICTIONARY) {
+				pd.value = pd.value.duplicate(true);
+			}
+			nd.properties.push_back(pd);
+		}
+		defaults.push_back(nd);
+
+		for (int i = node->get_child_count(false) - 1; i >= 0; i--) {
+			stack.push_back(node->get_child(i, false));
+		}
+	}
+}
+
+bool ScenePool::_restore_defaults(Node *p_root) const {
+	for (const NodeDefaults &nd : defaults) {
+		Node *node = p_root->get_node_or_null(nd.path);
+		if (!node) {
+			// The instance was changed too much to be reused.
+			return false;
+		}
+
+		for (const PropertyDefault &pd : nd.properties) {
+			Variant value = pd.value;
+			if (pd.is_node_reference) {
+				value = node->get_node_or_null(pd.value);
+			}
+
+			bool valid = false;
+			const Variant current = node->get(pd.name, &valid);
+			if (valid && current == value) {
+				continue;
+			}
+			if (value.get_type() == Variant::ARRAY || value.get_type() == Variant::DICTIONARY) {
+				node->set(pd.name, value.duplicate(true));
+			} else {
+				node->set(pd.name, value);
+			}
+		}
+
+		// Connections to methods made at run-time, for instance from `_ready()`, would be made again when reused.
+		// Custom callables are kept, as the engine uses them for its own internal connections.
+		List<Object::Connection> connections;
+		node->get_all_signal_connections(&connections);
+		node->get_signals_connected_to_this(&connections);
+		for (const Object::Connection &connection : connections) {
+			if ((connection.flags & Object::CONNECT_PERSIST) || connection.callable.is_custom()) {
+				continue;
+			}
+			Object *source = connection.signal.get_object();
+			if (source && source->is_connected(connection.signal.get_name(), connection.callable)) {
+				source->disconnect(connection.signal.get_name(), connection.callable);
+			}
+		}
+
+		// Behave like a fresh instance when added to the tree again.
+		node->request_ready();
+	}
+
+	return true;
+}
+
+void ScenePool::_free_node(Node *p_node) {
+	// The node may be releasing itself from one of its callbacks.
+	if (SceneTree::get_singleton()) {
+		p_node->queue_free();
+	} else {
+		memdelete(p_node);
+	}
+}
+
+void ScenePool::set_scene(const Ref<PackedScene> &p_scene) {
+	if (scene == p_scene) {
+		return;
+	}
+
+	clear();
+
+	// Instances of the previous scene can't be reused, but can still be released.
+	for (const ObjectID &id : acquired) {
+		if (ObjectDB::get_instance(id)) {
+			outdated.insert(id);
+		}
+	}
+	acquired.clear();
+	acquired_purge_size = 64;
+	releasing.clear();
+
+	defaults.clear();
+	defaults_valid = false;
+	scene = p_scene;
+}
+
+Ref<PackedScene> ScenePool::get_scene() const {
+	return scene;
+}
+
+void ScenePool::set_max_size(int p_max_size) {
+	ERR_FAIL_COND(p_max_size < 0);
+	max_size = p_max_size;
+
+	while ((int)available.size() > max_size) {
+		Node *node = ObjectDB::get_instance<Node>(available[available.size() - 1]);
+		available.resize(available.size() - 1);
+		total_available_count.decrement();
+		if (node) {
+			memdelete(node);
+		}
+	}
+}
+
+int ScenePool::get_max_size() const {
+	return max_size;
+}
+
+Node *ScenePool::acquire() {
+	while (!available.is_empty()) {
+		const ObjectID id = available[available.size() - 1];
+		available.resize(available.size() - 1);
+		total_available_count.decrement();
+
+		// Skip instances that were freed while in the pool.
+		Node *node = ObjectDB::get_instance<Node>(id);
+		if (node) {
+			hit_count++;
+			total_hit_count.increment();
+			acquired.insert(id);
+			return node;
+		}
+	}
+
+	Node *node = _instantiate();
+	ERR_FAIL_NULL_V(node, nullptr);
+	miss_count++;
+	total_miss_count.increment();
+
+	if (acquired.size() >= acquired_purge_size) {
+		// Forget instances that were freed instead of being released.
+		LocalVector<ObjectID> freed;
+		for (const ObjectID &id : acquired) {
+			if (!ObjectDB::get_instance(id)) {
+				freed.push_back(id);
+			}
+		}
+		for (const ObjectID &id : freed) {
+			acquired.erase(id);
+		}
+		acquired_purge_size = MAX(acquired_purge_size, acquired.size() * 2);
+	}
+	acquired.insert(node->get_instance_id());
+
+	return node;
+}
+
+void ScenePool::_pool_node(Node *p_node) {
+	Node *parent = p_node->get_parent();
+	if (parent) {
+		parent->remove_child(p_node);
+	}
+
+	if ((int)available.size() >= max_size || !_restore_defaults(p_node)) {
+		_free_node(p_node);
+		return;
+	}
+
+	available.push_back(p_node->get_instance_id());
+	total_available_count.increment();
+}
+
+void ScenePool::_pool_node_deferred(ObjectID p_id) {
+	Node *node = ObjectDB::get_instance<Node>(p_id);
+	if (!node) {
+		releasing.erase(p_id);
+		return;
+	}
+
+	if (!releasing.erase(p_id)) {
+		// The scene was changed in the meantime.
+		_free_node(node);
+		return;
+	}
+
+	_pool_node(node);
+}
+
+void ScenePool::release(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	const ObjectID id = p_node->get_instance_id();
+
+	if (outdated.erase(id)) {
+		_free_node(p_node);
+		return;
+	}
+
+	ERR_FAIL_COND_MSG(!acquired.erase(id), "Node was not acquired from this pool, or was already released.");
+
+	if (p_node->is_inside_tree()) {
+		// Instances are often released from signals emitted while physics or the parent are busy,
+		// where children can't be removed. They are pooled at the end of the frame instead.
+		releasing.insert(id);
+		callable_mp(this, &ScenePool::_pool_node_deferred).call_deferred(id);
+		return;
+	}
+
+	_pool_node(p_node);
+}
+
+void ScenePool::prewarm(int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+
+	const int count = MIN(p_count, max_size);
+	while ((int)available.size() < count) {
+		Node *node = _instantiate();
+		ERR_FAIL_NULL(node);
+		available.push_back(node->get_instance_id());
+		total_available_count.increment();
+	}
+}
+
+void ScenePool::clear() {
+	// Pooled instances are outside of the tree and not running any code, so they can be freed right away.
+	for (const ObjectID &id : available) {
+		Node *node = ObjectDB::get_instance<Node>(id);
+		if (node) {
+			memdelete(node);
+		}
+	}
+	total_available_count.sub(available.size());
+	available.clear();
+}
+
+int ScenePool::get_available_count() const {
+	return available.size();
+}
+
+uint64_t ScenePool::get_hit_count() const {
+	return hit_count;
+}
+
+uint64_t ScenePool::get_miss_count() const {
+	return miss_count;
+}
+
+void ScenePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_scene", "scene"), &ScenePool::set_scene);
+	ClassDB::bind_method(D_METHOD("get_scene"), &ScenePool::get_scene);
+	ClassDB::bind_method(D_METHOD("set_max_size", "max_size"), &ScenePool::set_max_size);
+	ClassDB::bind_method(D_METHOD("get_max_size"), &ScenePool::get_max_size);
+
+	ClassDB::bind_method(D_METHOD("acquire"), &ScenePool::acquire);
+	ClassDB::bind_method(D_METHOD("release", "node"), &ScenePool::release);
+	ClassDB::bind_method(D_METHOD("prewarm", "count"), &ScenePool::prewarm);
+	ClassDB::bind_method(D_METHOD("clear"), &ScenePool::clear);
+
+	ClassDB::bind_method(D_METHOD("get_available_count"), &ScenePool::get_available_count);
+	ClassDB::bind_method(D_METHOD("get_hit_count"), &ScenePool::get_hit_count);
+	ClassDB::bind_method(D_METHOD("get_miss_count"), &ScenePool::get_miss_count);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "scene", PROPERTY_HINT_RESOURCE_TYPE, PackedScene::get_class_static()), "set_scene", "get_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_size", PROPERTY_HINT_RANGE, "0,1024,1,or_greater"), "set_max_size", "get_max_size");
+}
+
+ScenePool::~ScenePool() {
+	clear();
+}
@@ -0,0 +1,108 @@
+/**************************************************************************/
+/*  scene_pool.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#include "scene/resources/packed_scene.h"
+
+class ScenePool : public RefCounted {
+	GDCLASS(ScenePool, RefCounted);
+
+	struct PropertyDefault {
+		StringName name;
+		Variant value;
+		// The value is the path to a node of the instance, relative to the node owning the property.
+		bool is_node_reference = false;
+	};
+
+	struct NodeDefaults {
+		NodePath path;
+		LocalVector<PropertyDefault> properties;
+	};
+
+	Ref<PackedScene> scene;
+	int max_size = 64;
+
+	LocalVector<ObjectID> available;
+	HashSet<ObjectID> acquired;
+	uint32_t acquired_purge_size = 64;
+	// Released while inside the tree, waiting for the end of the frame to be pooled.
+	HashSet<ObjectID> releasing;
+	// Acquired before the scene was changed, freed when released.
+	HashSet<ObjectID> outdated;
+
+	// Stored properties of a fresh instance, restored on release.
+	LocalVector<NodeDefaults> defaults;
+	bool defaults_valid = false;
+
+	uint64_t hit_count = 0;
+	uint64_t miss_count = 0;
+
+	static SafeNumeric<uint64_t> total_hit_count;
+	static SafeNumeric<uint64_t> total_miss_count;
+	static SafeNumeric<uint64_t> total_available_count;
+
+	static bool _has_instance_objects(const Variant &p_value);
+
+	Node *_instantiate();
+	void _record_defaults(Node *p_root);
+	bool _restore_defaults(Node *p_root) const;
+	void _free_node(Node *p_node);
+	void _pool_node(Node *p_node);
+	void _pool_node_deferred(ObjectID p_id);
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_scene(const Ref<PackedScene> &p_scene);
+	Ref<PackedScene> get_scene() const;
+
+	void set_max_size(int p_max_size);
+	int get_max_size() const;
+
+	Node *acquire();
+	void release(Node *p_node);
+	void prewarm(int p_count);
+	void clear();
+
+	int get_available_count() const;
+	uint64_t get_hit_count() const;
+	uint64_t get_miss_count() const;
+
+	static uint64_t get_total_hit_count() { return total_hit_count.get(); }
+	static uint64_t get_total_miss_count() { return total_miss_count.get(); }
+	static uint64_t get_total_available_count() { return total_available_count.get(); }
+
+	~ScenePool();
+};
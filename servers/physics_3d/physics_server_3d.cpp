@@ -482,6 +482,147 @@ Dictionary PhysicsDirectSpaceState3D::_get_rest_info(RequiredParam<PhysicsShapeQ
 	return r;
 }
 
+Dictionary PhysicsDirectSpaceState3D::_intersect_rays(RequiredParam<PhysicsRayQueryParameters3D> rp_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to) {
+	EXTRACT_PARAM_OR_FAIL_V(p_ray_query, rp_ray_query, Dictionary());
+	ERR_FAIL_COND_V_MSG(p_from.size() != p_to.size(), Dictionary(), "The number of ray starts and ends must match.");
+
+	const int count = p_from.size();
+	LocalVector<RayResult> results;
+	results.resize(count);
+	LocalVector<bool> hits;
+	hits.resize(count);
+
+	intersect_rays(p_ray_query->get_parameters(), p_from.ptr(), p_to.ptr(), count, results.ptr(), hits.ptr());
+
+	int hit_count = 0;
+	for (int i = 0; i < count; i++) {
+		hit_count += hits[i] ? 1 : 0;
+	}
+
+	PackedInt32Array ray_index;
+	PackedVector3Array position;
+	PackedVector3Array normal;
+	PackedInt64Array collider_id;
+	Array rid;
+	PackedInt32Array shape;
+	PackedInt32Array face_index;
+	ray_index.resize(hit_count);
+	position.resize(hit_count);
+	normal.resize(hit_count);
+	collider_id.resize(hit_count);
+	rid.resize(hit_count);
+	shape.resize(hit_count);
+	face_index.resize(hit_count);
+
+	int32_t *ray_index_w = ray_index.ptrw();
+	Vector3 *position_w = position.ptrw();
+	Vector3 *normal_w = normal.ptrw();
+	int64_t *collider_id_w = collider_id.ptrw();
+	int32_t *shape_w = shape.ptrw();
+	int32_t *face_index_w = face_index.ptrw();
+
+	int hit_idx = 0;
+	for (int i = 0; i < count; i++) {
+		if (!hits[i]) {
+			continue;
+		}
+		const RayResult &result = results[i];
+		ray_index_w[hit_idx] = i;
+		position_w[hit_idx] = result.position;
+		normal_w[hit_idx] = result.normal;
+		collider_id_w[hit_idx] = (int64_t)result.collider_id;
+		rid[hit_idx] = result.rid;
+		shape_w[hit_idx] = result.shape;
+		face_index_w[hit_idx] = result.face_index;
+		hit_idx++;
+	}
+
+	Dictionary d;
+	d["ray_index"] = ray_index;
+	d["position"] = position;
+	d["normal"] = normal;
+	d["collider_id"] = collider_id;
+	d["rid"] = rid;
+	d["shape"] = shape;
+	d["face_index"] = face_index;
+
+	return d;
+}
+
+Dictionary PhysicsDirectSpaceState3D::_intersect_shapes(RequiredParam<PhysicsShapeQueryParameters3D> rp_shape_query, const TypedArray<Transform3D> &p_transforms, int p_max_results) {
+	EXTRACT_PARAM_OR_FAIL_V(p_shape_query, rp_shape_query, Dictionary());
+	ERR_FAIL_COND_V(p_max_results < 0, Dictionary());
+
+	const int count = p_transforms.size();
+	LocalVector<Transform3D> transforms;
+	transforms.resize(count);
+	for (int i = 0; i < count; i++) {
+		transforms[i] = p_transforms[i];
+	}
+
+	LocalVector<ShapeResult> results;
+	results.resize(count * p_max_results);
+	LocalVector<int> result_counts;
+	result_counts.resize(count);
+
+	intersect_shapes(p_shape_query->get_parameters(), transforms.ptr(), count, results.ptr(), p_max_results, result_counts.ptr());
+
+	int total_count = 0;
+	for (int i = 0; i < count; i++) {
+		total_count += result_counts[i];
+	}
+
+	PackedInt32Array query_index;
+	PackedInt64Array collider_id;
+	Array rid;
+	PackedInt32Array shape;
+	query_index.resize(total_count);
+	collider_id.resize(total_count);
+	rid.resize(total_count);
+	shape.resize(total_count);
+
+	int32_t *query_index_w = query_index.ptrw();
+	int64_t *collider_id_w = collider_id.ptrw();
+	int32_t *shape_w = shape.ptrw();
+
+	int result_idx = 0;
+	for (int i = 0; i < count; i++) {
+		const ShapeResult *query_results = &results[i * p_max_results];
+		for (int j = 0; j < result_counts[i]; j++) {
+			query_index_w[result_idx] = i;
+			collider_id_w[result_idx] = (int64_t)query_results[j].collider_id;
+			rid[result_idx] = query_results[j].rid;
+			shape_w[result_idx] = query_results[j].shape;
+			result_idx++;
+		}
+	}
+
+	Dictionary d;
+	d["query_index"] = query_index;
+	d["collider_id"] = collider_id;
+	d["rid"] = rid;
+	d["shape"] = shape;
+
+	return d;
+}
+
+void PhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) {
+	RayParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.from = p_from[i];
+		parameters.to = p_to[i];
+		r_hits[i] = intersect_ray(parameters, r_results[i]);
+	}
+}
+
+void PhysicsDirectSpaceState3D::intersect_shapes(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	ShapeParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.transform = p_transforms[i];
+		r_result_counts[i] = intersect_shape(parameters, r_results + i * p_result_max, p_result_max);
+	}
+}
+
 PhysicsDirectSpaceState3D::PhysicsDirectSpaceState3D() {
 }
 
@@ -492,6 +633,8 @@ void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState3D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "parameters"), &PhysicsDirectSpaceState3D::_get_rest_info);
+	ClassDB::bind_method(D_METHOD("intersect_rays", "parameters", "from", "to"), &PhysicsDirectSpaceState3D::_intersect_rays);
+	ClassDB::bind_method(D_METHOD("intersect_shapes", "parameters", "transforms", "max_results"), &PhysicsDirectSpaceState3D::_intersect_shapes, DEFVAL(32));
 }
 
 ///////////////////////////////
@@ -668,6 +811,10 @@ bool PhysicsServer3D::_body_test_motion(RID p_body, RequiredParam<PhysicsTestMot
 	return body_test_motion(p_body, p_parameters->get_parameters(), result_ptr);
 }
 
+uint64_t PhysicsServer3D::space_get_state_hash(RID p_space) const {
+	ERR_FAIL_V_MSG(0, "Space state hashing is not supported by this physics server.");
+}
+
 RID PhysicsServer3D::shape_create(ShapeType p_shape) {
 	switch (p_shape) {
 		case SHAPE_WORLD_BOUNDARY:
@@ -722,6 +869,7 @@ void PhysicsServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("space_set_param", "space", "param", "value"), &PhysicsServer3D::space_set_param);
 	ClassDB::bind_method(D_METHOD("space_get_param", "space", "param"), &PhysicsServer3D::space_get_param);
 	ClassDB::bind_method(D_METHOD("space_get_direct_state", "space"), &PhysicsServer3D::space_get_direct_state);
+	ClassDB::bind_method(D_METHOD("space_get_state_hash", "space"), &PhysicsServer3D::space_get_state_hash);
 
 	ClassDB::bind_method(D_METHOD("area_create"), &PhysicsServer3D::area_create);
 	ClassDB::bind_method(D_METHOD("area_set_space", "area", "space"), &PhysicsServer3D::area_set_space);
@@ -1153,6 +1301,7 @@ PhysicsServer3D::PhysicsServer3D() {
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_separation", PROPERTY_HINT_RANGE, "0,0.1,0.001,or_greater"), 0.05);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_allowed_penetration", PROPERTY_HINT_RANGE, "0.001,0.1,0.001,or_greater"), 0.01);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/default_contact_bias", PROPERTY_HINT_RANGE, "0,1,0.01"), 0.8);
+	GLOBAL_DEF(PropertyInfo(Variant::BOOL, "physics/3d/solver/deterministic_simulation"), false);
 }
 
 PhysicsServer3D::~PhysicsServer3D() {
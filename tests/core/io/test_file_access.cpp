@@ -34,6 +34,7 @@ TEST_FORCE_LINK(test_file_access)
 
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_memory.h"
 #include "tests/test_utils.h"
 
 namespace TestFileAccess {
@@ -297,4 +298,42 @@ TEST_CASE("[FileAccess] Cursor positioning") {
 	}
 }
 
+TEST_CASE("[FileAccess] Buffer views") {
+	SUBCASE("Files on disk") {
+		Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("line_endings_lf.test.txt"), FileAccess::READ);
+		REQUIRE(f.is_valid());
+		const Vector<uint8_t> contents = f->get_buffer(f->get_length());
+		REQUIRE(contents.size() > 6);
+
+		f->seek(2);
+		const Span<const uint8_t> view = f->get_buffer_view(4);
+		if (view.is_empty()) {
+			// Not supported by this platform, the position must be left untouched.
+			CHECK(f->get_position() == 2);
+		} else {
+			CHECK(view.size() == 4);
+			CHECK(memcmp(view.ptr(), contents.ptr() + 2, 4) == 0);
+			CHECK(f->get_position() == 6);
+
+			const Span<const uint8_t> rest = f->get_buffer_view(contents.size());
+			CHECK(rest.size() == uint64_t(contents.size() - 6));
+			CHECK(f->get_position() == uint64_t(contents.size()));
+			CHECK(f->get_buffer_view(1).is_empty());
+		}
+	}
+
+	SUBCASE("Files in memory") {
+		const uint8_t data[] = { 1, 2, 3, 4, 5 };
+		Ref<FileAccessMemory> f;
+		f.instantiate();
+		REQUIRE(f->open_custom(data, std::size(data)) == OK);
+
+		f->seek(1);
+		const Span<const uint8_t> view = f->get_buffer_view(10);
+		CHECK(view.size() == 4);
+		CHECK(view.ptr() == data + 1);
+		CHECK(f->get_position() == 5);
+	}
+}
+
 } // namespace TestFileAccess
@@ -32,8 +32,11 @@
 
 TEST_FORCE_LINK(test_json)
 
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
 #include "core/io/json.h"
 #include "core/variant/typed_array.h"
+#include "tests/test_utils.h"
 
 namespace TestJSON {
 
@@ -425,4 +428,66 @@ TEST_CASE("[JSON] Serialization") {
 	}
 }
 
+TEST_CASE("[JSON] Files") {
+	const String path = TestUtils::get_temp_path("json_file.json");
+
+	Dictionary data;
+	data["ascii"] = "Pretty Woman";
+	data["unicode"] = String::utf8("K\xC3\xA4se \xF0\x9F\x8E\xA4 \xEF\xBB\xBF");
+	data["escapes"] = "line\nbreak \"quoted\" back\\slash";
+	Array numbers = { 1, -2.5, 1e30 };
+	data["numbers"] = numbers;
+	data["nested"] = Dictionary({ { "null", Variant() }, { "bool", true } });
+
+	SUBCASE("Writing matches stringify()") {
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		CHECK_EQ(JSON::stringify_to_file(f, data, "\t"), OK);
+		f.unref();
+
+		CHECK_EQ(FileAccess::get_file_as_string(path), JSON::stringify(data, "\t"));
+	}
+
+	SUBCASE("Reading matches parse()") {
+		const String text = JSON::stringify(data, "  ");
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		// Byte order mark, which must be skipped.
+		f->store_8(0xef);
+		f->store_8(0xbb);
+		f->store_8(0xbf);
+		f->store_string(text);
+		f.unref();
+
+		Ref<JSON> from_file;
+		from_file.instantiate();
+		f = FileAccess::open(path, FileAccess::READ);
+		CHECK_EQ(from_file->parse_file(f, true), OK);
+		CHECK_EQ(from_file->get_parsed_text(), text);
+
+		Ref<JSON> from_string;
+		from_string.instantiate();
+		CHECK_EQ(from_string->parse(text), OK);
+		CHECK_EQ(from_file->get_data(), from_string->get_data());
+	}
+
+	SUBCASE("Reading reports errors like parse()") {
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string("{\n\"a\": [1, 2,\n\"unterminated]\n}");
+		f.unref();
+
+		Ref<JSON> json;
+		json.instantiate();
+		f = FileAccess::open(path, FileAccess::READ);
+		ERR_PRINT_OFF
+		CHECK_EQ(json->parse_file(f), ERR_PARSE_ERROR);
+		ERR_PRINT_ON
+		CHECK_EQ(json->get_error_message(), "Unterminated string");
+		CHECK_EQ(json->get_error_line(), 3);
+	}
+
+	DirAccess::remove_absolute(path);
+}
+
 } // namespace TestJSON
@@ -121,6 +121,80 @@ TEST_CASE("[String] UTF16") {
 	CHECK(String::utf16(cs) == parsed);
 }
 
+TEST_CASE("[String] UTF8 and UTF16 fast paths match per-character conversion") {
+	// Long ASCII or BMP runs take block-wise fast paths, single characters never do.
+	// Move one special character across block boundaries and compare both.
+	static const char32_t specials[] = { 0x00E9, 0x304A, 0xD7FF, 0xE000, 0x1F3A4 };
+	for (char32_t special : specials) {
+		for (int pos = 0; pos < 40; pos++) {
+			String s;
+			for (int i = 0; i < 40; i++) {
+				s += i == pos ? special : char32_t('a' + i % 26);
+			}
+
+			CharString expected_utf8;
+			Char16String expected_utf16;
+			for (int i = 0; i < s.length(); i++) {
+				const String c = String::chr(s[i]);
+				const CharString c_utf8 = c.utf8();
+				for (int j = 0; j < c_utf8.length(); j++) {
+					expected_utf8 += c_utf8[j];
+				}
+				const Char16String c_utf16 = c.utf16();
+				for (int j = 0; j < c_utf16.length(); j++) {
+					expected_utf16 += c_utf16[j];
+				}
+			}
+
+			Vector<uint8_t> ch_length_map;
+			const CharString utf8 = s.utf8(&ch_length_map);
+			CHECK(utf8 == expected_utf8);
+			CHECK_EQ(ch_length_map.size(), s.length());
+			CHECK_EQ(ch_length_map[pos], String::chr(special).utf8().length());
+			CHECK_EQ(ch_length_map[(pos + 20) % 40], 1);
+			CHECK(String::utf8(utf8.get_data(), utf8.length()) == s);
+
+			const Char16String utf16 = s.utf16();
+			CHECK(utf16 == expected_utf16);
+			CHECK(String::utf16(utf16.get_data(), utf16.length()) == s);
+			CHECK(String::utf16(utf16.get_data()) == s);
+
+			Char16String swapped = utf16;
+			for (int i = 0; i < swapped.length(); i++) {
+				swapped.ptrw()[i] = BSWAP16(uint16_t(utf16[i]));
+			}
+			String parsed;
+			CHECK_EQ(parsed.append_utf16(swapped.get_data(), swapped.length(), false), OK);
+			CHECK(parsed == s);
+
+			CHECK_EQ(s.find_char(special), pos);
+			CHECK_EQ(s.find(String::chr(special) + s.substr(pos + 1, 3)), pos);
+		}
+	}
+
+	// NUL stops UTF-8 decoding inside a run as well.
+	const char with_nul[] = "0123456789abcdefghijklmnopq\0rstuvwxyz";
+	CHECK(String::utf8(with_nul, sizeof(with_nul) - 1) == "0123456789abcdefghijklmnopq");
+}
+
+TEST_CASE("[String] Find in long strings") {
+	String s;
+	for (int i = 0; i < 100; i++) {
+		s += "abcdefgh";
+	}
+	s += "needle";
+	s += "abcdefgh";
+	CHECK_EQ(s.find("needle"), 800);
+	CHECK_EQ(s.find(String("needle")), 800);
+	CHECK_EQ(s.find("needle", 801), -1);
+	CHECK_EQ(s.find("habc", 790), 791);
+	CHECK_EQ(s.find_char('n'), 800);
+	CHECK_EQ(s.find_char('n', 801), -1);
+	CHECK_EQ(s.find_char('z'), -1);
+	CHECK_EQ(s.find("gh", s.length() - 2), s.length() - 2);
+	CHECK_EQ(s.find("ghx"), -1);
+}
+
 TEST_CASE("[String] UTF8 with BOM") {
 	/* how can i embed UTF in here? */
 	static const char32_t u32str[] = { 0x0045, 0x0020, 0x304A, 0x360F, 0x3088, 0x3046, 0x1F3A4, 0 };
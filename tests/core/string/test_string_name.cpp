@@ -0,0 +1,83 @@
+/**************************************************************************/
+/*  test_string_name.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_string_name)
+
+#include "core/object/worker_thread_pool.h"
+#include "core/string/string_name.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Equality and hashing") {
+	const StringName a = "some_name";
+	const StringName b = String("some_name");
+	const StringName c = "other_name";
+
+	CHECK(a == b);
+	CHECK(a.data_unique_pointer() == b.data_unique_pointer());
+	CHECK(a != c);
+	CHECK(a.hash() == String("some_name").hash());
+	CHECK(StringName().is_empty());
+	CHECK(StringName("").is_empty());
+}
+
+static const uint32_t THREADED_NAME_COUNT = 2048;
+static LocalVector<StringName> threaded_names[4];
+
+static void threaded_intern(void *p_userdata, uint32_t p_index) {
+	LocalVector<StringName> &names = threaded_names[p_index];
+	names.resize(THREADED_NAME_COUNT);
+	for (uint32_t i = 0; i < THREADED_NAME_COUNT; i++) {
+		// Alternate construction order per task, so tasks race on creating and releasing the same names.
+		const uint32_t n = (p_index % 2) ? THREADED_NAME_COUNT - 1 - i : i;
+		names[n] = StringName("threaded_name_" + itos(n));
+		StringName transient = StringName("transient_name_" + itos(n));
+	}
+}
+
+TEST_CASE("[StringName] Interning from multiple threads") {
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(threaded_intern, nullptr, std::size(threaded_names), -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	for (uint32_t i = 0; i < THREADED_NAME_COUNT; i++) {
+		const StringName expected = StringName("threaded_name_" + itos(i));
+		for (const LocalVector<StringName> &names : threaded_names) {
+			CHECK(names[i].data_unique_pointer() == expected.data_unique_pointer());
+		}
+	}
+
+	for (LocalVector<StringName> &names : threaded_names) {
+		names.clear();
+	}
+}
+
+} // namespace TestStringName
@@ -108,6 +108,126 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+static SafeNumeric<int> nested_total;
+static SafeFlag outside_thread_index_seen;
+
+static void static_nested_leaf_test(void *p_arg) {
+	nested_total.increment();
+}
+
+static void static_nested_test(void *p_arg) {
+	if (WorkerThreadPool::get_singleton()->get_thread_index() == -1) {
+		outside_thread_index_seen.set();
+	}
+	// Posting from a pool thread and waiting on it exercises the collaborative wait.
+	WorkerThreadPool::TaskID task_ids[8];
+	for (int i = 0; i < 8; i++) {
+		task_ids[i] = WorkerThreadPool::get_singleton()->add_native_task(static_nested_leaf_test, nullptr, true);
+	}
+	for (int i = 0; i < 8; i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_ids[i]);
+	}
+}
+
+static void static_poster_thread(void *p_arg) {
+	const int count = (int)(uintptr_t)p_arg;
+	LocalVector<WorkerThreadPool::TaskID> task_ids;
+	task_ids.resize(count);
+	for (int i = 0; i < count; i++) {
+		task_ids[i] = WorkerThreadPool::get_singleton()->add_native_task(static_nested_test, nullptr, i % 2);
+	}
+	for (int i = 0; i < count; i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_ids[i]);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Post and wait for tasks from several threads at once") {
+	const int thread_count = 4;
+	const int tasks_per_thread = 64;
+	nested_total.set(0);
+	outside_thread_index_seen.clear();
+
+	CHECK_MESSAGE(WorkerThreadPool::get_singleton()->get_thread_index() == -1, "The main thread should not be reported as a pool thread.");
+
+	Thread posters[thread_count];
+	for (int i = 0; i < thread_count; i++) {
+		posters[i].start(static_poster_thread, (void *)(uintptr_t)tasks_per_thread);
+	}
+	for (int i = 0; i < thread_count; i++) {
+		posters[i].wait_to_finish();
+	}
+
+	CHECK_MESSAGE(!outside_thread_index_seen.is_set(), "Tasks should always know which pool thread runs them.");
+	CHECK(nested_total.get() == thread_count * tasks_per_thread * 8);
+}
+
+static SafeNumeric<int> stage_counter;
+static LocalVector<int> stage_seen;
+
+static void static_stage_test(void *p_arg) {
+	// Records how many stages had run before this one started.
+	stage_seen[(uintptr_t)p_arg] = stage_counter.get();
+	stage_counter.increment();
+}
+
+static void static_group_stage_test(void *p_arg, uint32_t p_index) {
+	counter[p_index].set(stage_counter.get());
+}
+
+TEST_CASE("[WorkerThreadPool] Run tasks and groups after their dependencies") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const bool low_priority = Math::rand() % 2;
+		stage_counter.set(0);
+		stage_seen.clear();
+		stage_seen.resize(4);
+		counter.clear();
+		counter.resize(16);
+
+		// Diamond: a -> (b, c) -> group -> d.
+		WorkerThreadPool::TaskID a = WorkerThreadPool::get_singleton()->add_native_task(static_stage_test, (void *)0, !low_priority);
+		WorkerThreadPool::TaskID a_deps[] = { a };
+		WorkerThreadPool::TaskID b = WorkerThreadPool::get_singleton()->add_native_task_after(a_deps, static_stage_test, (void *)1, low_priority);
+		WorkerThreadPool::TaskID c = WorkerThreadPool::get_singleton()->add_native_task_after(a_deps, static_stage_test, (void *)2, !low_priority);
+		WorkerThreadPool::TaskID bc_deps[] = { b, c };
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task_after(bc_deps, static_group_stage_test, nullptr, 16, 4, low_priority);
+		WorkerThreadPool::TaskID group_deps[] = { group };
+		WorkerThreadPool::TaskID d = WorkerThreadPool::get_singleton()->add_native_task_after(group_deps, static_stage_test, (void *)3, !low_priority);
+
+		// Only waiting on the last stage, in reverse order, to make sure nothing relies on waiting.
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(d);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(c);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(b);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(a);
+
+		CHECK(stage_seen[0] == 0);
+		CHECK(stage_seen[1] >= 1);
+		CHECK(stage_seen[2] >= 1);
+		CHECK(stage_seen[3] == 3);
+
+		bool all_after_dependencies = true;
+		for (int i = 0; i < 16; i++) {
+			all_after_dependencies &= counter[i].get() == 3;
+		}
+		CHECK(all_after_dependencies);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Depending on already awaited tasks does not hold the task back") {
+	stage_counter.set(0);
+	stage_seen.clear();
+	stage_seen.resize(2);
+
+	WorkerThreadPool::TaskID first = WorkerThreadPool::get_singleton()->add_native_task(static_stage_test, (void *)0);
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(first);
+
+	WorkerThreadPool::TaskID deps[] = { first };
+	WorkerThreadPool::TaskID second = WorkerThreadPool::get_singleton()->add_native_task_after(deps, static_stage_test, (void *)1);
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(second);
+
+	CHECK(stage_seen[1] == 1);
+}
+
 static void static_test_daemon(void *p_arg) {
 	while (!exit.is_set()) {
 		counter[0].add(1);
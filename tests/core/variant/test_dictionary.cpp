@@ -601,6 +601,36 @@ TEST_CASE("[Dictionary] Order and find") {
 	CHECK_EQ(d.find_key("does not exist"), Variant());
 }
 
+TEST_CASE("[Dictionary] Order and pointer stability after erase and growth") {
+	Dictionary d;
+	d[1] = "one";
+	d[2] = "two";
+	d[3] = "three";
+
+	Variant *two = d.getptr(2);
+	REQUIRE(two != nullptr);
+
+	d.erase(1);
+	d[1] = "one again";
+	Array keys = { 2, 3, 1 };
+	CHECK_EQ(d.keys(), keys);
+
+	// Elements must not move when the table grows.
+	for (int i = 100; i < 1100; i++) {
+		d[i] = i;
+	}
+	CHECK_EQ(d.getptr(2), two);
+	CHECK_EQ(*two, Variant("two"));
+	CHECK_EQ(d.get_key_at_index(0), Variant(2));
+	CHECK_EQ(d.get_key_at_index(2), Variant(1));
+	CHECK_EQ(d.get_key_at_index(1002), Variant(1099));
+
+	d.clear();
+	CHECK(d.is_empty());
+	d[5] = 5;
+	CHECK_EQ(d.size(), 1);
+}
+
 TEST_CASE("[Dictionary] sort()") {
 	Dictionary d;
 	d[3] = 3;
@@ -32,8 +32,10 @@
 
 TEST_FORCE_LINK(test_variant)
 
+#include "core/io/dir_access.h"
 #include "core/variant/variant.h"
 #include "core/variant/variant_parser.h"
+#include "tests/test_utils.h"
 
 namespace TestVariant {
 
@@ -1836,6 +1838,48 @@ TEST_CASE("[Variant] Writer and parser dictionary") {
 	CHECK_MESSAGE(d_parsed == Variant(d), "Should parse back.");
 }
 
+TEST_CASE("[Variant] Parser strings from UTF-8 files") {
+	String long_text;
+	for (int i = 0; i < 300; i++) {
+		long_text += String::utf8("K\xC3\xA4se \xF0\x9F\x8E\xA4 ");
+	}
+	const String source = String::utf8("[\"K\xC3\xA4se \xF0\x9F\x8E\xA4\", \"\\u0041\\t\\U00007e\\\"\", &\"name_\xC3\xA4\", \"line\nnext\", \"\", \"") + long_text + "\"]";
+	const String path = TestUtils::get_temp_path("variant_parser_utf8.txt");
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string(source);
+	}
+
+	VariantParser::StreamFile file_stream;
+	file_stream.f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(file_stream.f.is_valid());
+	String errs;
+	int line = 0;
+	Variant from_file;
+	CHECK_EQ(VariantParser::parse(&file_stream, from_file, errs, line), OK);
+
+	VariantParser::StreamString string_stream;
+	string_stream.s = source;
+	line = 0;
+	Variant from_string;
+	CHECK_EQ(VariantParser::parse(&string_stream, from_string, errs, line), OK);
+
+	CHECK_EQ(from_file, from_string);
+	const Array parsed = from_file;
+	REQUIRE_EQ(parsed.size(), 6);
+	CHECK_EQ(parsed[0], Variant(String::utf8("K\xC3\xA4se \xF0\x9F\x8E\xA4")));
+	CHECK_EQ(parsed[1], Variant("A\t~\""));
+	CHECK_EQ(parsed[2].get_type(), Variant::STRING_NAME);
+	CHECK_EQ(parsed[2], Variant(StringName(String::utf8("name_\xC3\xA4"))));
+	CHECK_EQ(parsed[3], Variant("line\nnext"));
+	CHECK_EQ(parsed[4], Variant(""));
+	CHECK_EQ(parsed[5], Variant(long_text));
+
+	file_stream.f.unref();
+	DirAccess::remove_absolute(path);
+}
+
 TEST_CASE("[Variant] Writer key sorting") {
 	Dictionary d = { { StringName("C"), 3 }, { "A", 1 }, { StringName("B"), 2 }, { "D", 4 } };
 	String d_str;
@@ -0,0 +1,98 @@
+/**************************************************************************/
+/*  test_variant_pools.cpp                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_variant_pools)
+
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/variant/variant.h"
+#include "core/variant/variant_pools.h"
+
+namespace TestVariantPools {
+
+struct PoolsTester {
+	static constexpr int VARIANT_COUNT = 1000;
+
+	// Variants each thread leaves behind, freed by the main thread once it's done.
+	LocalVector<LocalVector<Variant>> leftovers;
+	TightLocalVector<Thread> threads;
+
+	static void thread_func(void *p_userdata) {
+		LocalVector<Variant> &leftover = *static_cast<LocalVector<Variant> *>(p_userdata);
+		for (int i = 0; i < VARIANT_COUNT; i++) {
+			// One type per bucket, freed in a different order than allocated.
+			Variant aabb = AABB(Vector3(i, 0, 0), Vector3(1, 1, 1));
+			Variant transform = Transform3D(Basis(), Vector3(0, i, 0));
+			Variant projection = Projection();
+			if (i % 2 == 0) {
+				leftover.push_back(transform);
+			}
+			if (i % 3 == 0) {
+				leftover.push_back(aabb);
+				leftover.push_back(projection);
+			}
+		}
+	}
+};
+
+TEST_CASE("[VariantPools] Elements return to the pools from several threads") {
+	const VariantPools::BucketType buckets[] = { VariantPools::BUCKET_TYPE_SMALL, VariantPools::BUCKET_TYPE_MEDIUM, VariantPools::BUCKET_TYPE_LARGE };
+	uint64_t baseline[3];
+	for (int i = 0; i < 3; i++) {
+		baseline[i] = VariantPools::get_used_memory(buckets[i]);
+	}
+
+	PoolsTester tester;
+	const uint32_t thread_count = MAX(2, OS::get_singleton()->get_processor_count());
+	tester.leftovers.resize(thread_count);
+	tester.threads.resize(thread_count);
+	for (uint32_t i = 0; i < thread_count; i++) {
+		tester.threads[i].start(PoolsTester::thread_func, &tester.leftovers[i]);
+	}
+	for (Thread &thread : tester.threads) {
+		thread.wait_to_finish();
+	}
+
+	// Caches of exited threads hand their elements back, so only the leftovers are still in use.
+	for (int i = 0; i < 3; i++) {
+		CHECK(VariantPools::get_used_memory(buckets[i]) > baseline[i]);
+	}
+
+	// Freeing elements allocated by other threads.
+	tester.leftovers.clear();
+
+	for (int i = 0; i < 3; i++) {
+		CHECK_MESSAGE(VariantPools::get_used_memory(buckets[i]) == baseline[i], vformat("Bucket %d didn't return to its baseline.", i));
+	}
+}
+
+} // namespace TestVariantPools
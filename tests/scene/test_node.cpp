@@ -917,4 +917,51 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 	memdelete(node4);
 }
 
+TEST_CASE("[SceneTree][Node] Test processing each child in its own thread group") {
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	const int child_count = 8;
+	TestNode *children[child_count];
+	TestNode *grandchildren[child_count];
+	for (int i = 0; i < child_count; i++) {
+		children[i] = memnew(TestNode);
+		grandchildren[i] = memnew(TestNode);
+		children[i]->add_child(grandchildren[i]);
+		parent->add_child(children[i]);
+		children[i]->set_process(true);
+		grandchildren[i]->set_physics_process(true);
+	}
+
+	parent->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD_PER_CHILD);
+
+	// Added after the mode is set, so it gets its group when entering the tree.
+	TestNode *late_child = memnew(TestNode);
+	late_child->set_process(true);
+	parent->add_child(late_child);
+
+	SceneTree::get_singleton()->process(0);
+	SceneTree::get_singleton()->physics_process(0);
+
+	for (int i = 0; i < child_count; i++) {
+		CHECK_EQ(1, children[i]->process_counter);
+		CHECK_EQ(1, grandchildren[i]->physics_process_counter);
+	}
+	CHECK_EQ(1, late_child->process_counter);
+
+	// Children with their own mode keep it.
+	children[0]->set_process_thread_group(Node::PROCESS_THREAD_GROUP_MAIN_THREAD);
+	parent->set_process_thread_group(Node::PROCESS_THREAD_GROUP_INHERIT);
+	SceneTree::get_singleton()->process(0);
+	SceneTree::get_singleton()->physics_process(0);
+
+	for (int i = 0; i < child_count; i++) {
+		CHECK_EQ(2, children[i]->process_counter);
+		CHECK_EQ(2, grandchildren[i]->physics_process_counter);
+	}
+	CHECK_EQ(2, late_child->process_counter);
+
+	memdelete(parent);
+}
+
 } // namespace TestNode
@@ -0,0 +1,102 @@
+/**************************************************************************/
+/*  test_node_3d.cpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_node_3d)
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+
+namespace TestNode3D {
+
+class TransformNotifiedNode3D : public Node3D {
+	GDCLASS(TransformNotifiedNode3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			transform_changed_count++;
+		}
+	}
+
+public:
+	int transform_changed_count = 0;
+};
+
+TEST_CASE("[SceneTree][Node3D] Global transforms stay correct when changed repeatedly within a frame") {
+	Node3D *parent = memnew(Node3D);
+	Node3D *child = memnew(Node3D);
+	TransformNotifiedNode3D *grandchild = memnew(TransformNotifiedNode3D);
+	parent->add_child(child);
+	child->add_child(grandchild);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	SUBCASE("Moving an ancestor after a descendant is already dirty") {
+		child->set_position(Vector3(1, 0, 0));
+		parent->set_position(Vector3(0, 1, 0));
+		parent->set_position(Vector3(0, 2, 0));
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(1, 2, 0)));
+	}
+
+	SUBCASE("Moving a node again after its global transform was read") {
+		parent->set_position(Vector3(0, 1, 0));
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(0, 1, 0)));
+		parent->set_position(Vector3(0, 3, 0));
+		child->set_position(Vector3(2, 0, 0));
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(2, 3, 0)));
+	}
+
+	SUBCASE("Reading a sibling does not clean a dirty subtree") {
+		Node3D *sibling = memnew(Node3D);
+		parent->add_child(sibling);
+		parent->set_position(Vector3(0, 0, 1));
+		CHECK(sibling->get_global_position().is_equal_approx(Vector3(0, 0, 1)));
+		parent->set_position(Vector3(0, 0, 4));
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(0, 0, 4)));
+		CHECK(sibling->get_global_position().is_equal_approx(Vector3(0, 0, 4)));
+		memdelete(sibling);
+	}
+
+	SUBCASE("Transform notifications are still sent to nodes that enable them later") {
+		parent->set_position(Vector3(1, 1, 1));
+		grandchild->set_notify_transform(true);
+		parent->set_position(Vector3(2, 2, 2));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK_EQ(grandchild->transform_changed_count, 1);
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(2, 2, 2)));
+	}
+
+	memdelete(grandchild);
+	memdelete(child);
+	memdelete(parent);
+}
+
+} // namespace TestNode3D
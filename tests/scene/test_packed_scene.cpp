@@ -217,6 +217,47 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Packed Scene With Properties") {
+	// Create a scene with non-default native properties to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	scene->set_process_priority(3);
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	child->set_process_mode(Node::PROCESS_MODE_ALWAYS);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// Properties must be applied on every instance.
+	for (int i = 0; i < 2; i++) {
+		Node *instance = packed_scene.instantiate();
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_process_priority() == 3);
+		REQUIRE(instance->get_child_count() == 1);
+		CHECK(instance->get_child(0)->get_process_mode() == Node::PROCESS_MODE_ALWAYS);
+		memdelete(instance);
+	}
+
+	// Packing again must not reuse the previous scene's setters.
+	child->set_process_mode(Node::PROCESS_MODE_DISABLED);
+	scene->remove_child(child);
+	scene->set_process_priority(0);
+	packed_scene.pack(child);
+
+	Node *instance = packed_scene.instantiate();
+	REQUIRE(instance != nullptr);
+	CHECK(instance->get_process_priority() == 0);
+	CHECK(instance->get_process_mode() == Node::PROCESS_MODE_DISABLED);
+	memdelete(instance);
+
+	memdelete(child);
+	memdelete(scene);
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
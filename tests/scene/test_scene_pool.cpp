@@ -0,0 +1,271 @@
+/**************************************************************************/
+/*  test_scene_pool.cpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_scene_pool)
+
+#include "core/object/callable_mp.h"
+#include "core/object/class_db.h"
+#include "core/object/message_queue.h"
+#include "scene/2d/node_2d.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+#include "scene/resources/scene_pool.h"
+
+namespace TestScenePool {
+
+class _TestScenePoolNode : public Node2D {
+	GDCLASS(_TestScenePoolNode, Node2D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_READY) {
+			// Like a script connecting a signal in `_ready()`.
+			ready_count++;
+			connect_error = get_node(NodePath("Sprite"))->connect(SNAME("renamed"), Callable(this, "_on_sprite_renamed"));
+		}
+	}
+
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("set_target", "target"), &_TestScenePoolNode::set_target);
+		ClassDB::bind_method(D_METHOD("get_target"), &_TestScenePoolNode::get_target);
+		ClassDB::bind_method(D_METHOD("_on_sprite_renamed"), &_TestScenePoolNode::_on_sprite_renamed);
+
+		ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "target", PROPERTY_HINT_NODE_TYPE, "Node"), "set_target", "get_target");
+	}
+
+public:
+	Variant target;
+	int ready_count = 0;
+	Error connect_error = OK;
+	int renamed_count = 0;
+
+	void set_target(const Variant &p_target) { target = p_target; }
+	Variant get_target() const { return target; }
+
+	void _on_sprite_renamed() { renamed_count++; }
+};
+
+static Ref<PackedScene> _make_scene() {
+	Node2D *root = memnew(Node2D);
+	root->set_name("Bullet");
+	root->set_position(Point2(1, 2));
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Sprite");
+	root->add_child(child);
+	child->set_owner(root);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(root);
+	memdelete(root);
+	return packed_scene;
+}
+
+TEST_CASE("[SceneTree][ScenePool] Acquire and release") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_make_scene());
+
+	const uint64_t total_misses = ScenePool::get_total_miss_count();
+	const uint64_t total_hits = ScenePool::get_total_hit_count();
+
+	Node2D *bullet = Object::cast_to<Node2D>(pool->acquire());
+	REQUIRE(bullet != nullptr);
+	CHECK(pool->get_miss_count() == 1);
+	CHECK(pool->get_hit_count() == 0);
+	CHECK(ScenePool::get_total_miss_count() == total_misses + 1);
+
+	// Use the instance in the tree and change it.
+	SceneTree::get_singleton()->get_root()->add_child(bullet);
+	bullet->set_position(Point2(10, 20));
+	Node2D *sprite = Object::cast_to<Node2D>(bullet->get_node(NodePath("Sprite")));
+	REQUIRE(sprite != nullptr);
+	sprite->set_rotation(1.0);
+
+	// Instances inside the tree are pooled at the end of the frame.
+	pool->release(bullet);
+	CHECK(bullet->get_parent() == SceneTree::get_singleton()->get_root());
+	CHECK(pool->get_available_count() == 0);
+	MessageQueue::get_singleton()->flush();
+	CHECK(bullet->get_parent() == nullptr);
+	CHECK(pool->get_available_count() == 1);
+
+	// The same instance comes back, reset to the scene's values.
+	Node2D *reused = Object::cast_to<Node2D>(pool->acquire());
+	CHECK(reused == bullet);
+	CHECK(pool->get_hit_count() == 1);
+	CHECK(ScenePool::get_total_hit_count() == total_hits + 1);
+	CHECK(pool->get_available_count() == 0);
+	CHECK(reused->get_position() == Point2(1, 2));
+	CHECK(Object::cast_to<Node2D>(reused->get_node(NodePath("Sprite")))->get_rotation() == 0.0);
+
+	memdelete(reused);
+}
+
+TEST_CASE("[SceneTree][ScenePool] Size limit") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_make_scene());
+	pool->set_max_size(2);
+
+	pool->prewarm(5);
+	CHECK(pool->get_available_count() == 2);
+	CHECK(pool->get_miss_count() == 0);
+
+	Node *a = pool->acquire();
+	Node *b = pool->acquire();
+	Node *c = pool->acquire();
+	CHECK(pool->get_hit_count() == 2);
+	CHECK(pool->get_miss_count() == 1);
+
+	pool->release(a);
+	pool->release(b);
+	const ObjectID c_id = c->get_instance_id();
+	pool->release(c); // Freed, the pool is full.
+	CHECK(pool->get_available_count() == 2);
+	CHECK(c->is_queued_for_deletion());
+
+	pool->set_max_size(1);
+	CHECK(pool->get_available_count() == 1);
+
+	pool->clear();
+	CHECK(pool->get_available_count() == 0);
+
+	// Nodes that didn't come from the pool are rejected.
+	Node *other = memnew(Node);
+	ERR_PRINT_OFF;
+	pool->release(other);
+	ERR_PRINT_ON;
+	CHECK(pool->get_available_count() == 0);
+	memdelete(other);
+
+	SceneTree::get_singleton()->process(0); // Flush the deletion queue.
+	CHECK(ObjectDB::get_instance(c_id) == nullptr);
+}
+
+TEST_CASE("[SceneTree][ScenePool] Node references and signals connected in ready") {
+	GDREGISTER_CLASS(_TestScenePoolNode);
+
+	_TestScenePoolNode *root = memnew(_TestScenePoolNode);
+	root->set_name("Bullet");
+	Node2D *child = memnew(Node2D);
+	child->set_name("Sprite");
+	root->add_child(child);
+	child->set_owner(root);
+	root->set_target(child);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(root);
+	memdelete(root);
+
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(packed_scene);
+
+	// Defaults are recorded from the first instance, the second one must not point into it.
+	_TestScenePoolNode *first = Object::cast_to<_TestScenePoolNode>(pool->acquire());
+	_TestScenePoolNode *second = Object::cast_to<_TestScenePoolNode>(pool->acquire());
+	REQUIRE(first != nullptr);
+	REQUIRE(second != nullptr);
+
+	Window *tree_root = SceneTree::get_singleton()->get_root();
+	tree_root->add_child(second);
+	CHECK(second->ready_count == 1);
+	CHECK(second->connect_error == OK);
+
+	second->set_target(Variant());
+	pool->release(second);
+	MessageQueue::get_singleton()->flush();
+
+	_TestScenePoolNode *reused = Object::cast_to<_TestScenePoolNode>(pool->acquire());
+	REQUIRE(reused == second);
+	CHECK(Object::cast_to<Node>(reused->get_target()) == reused->get_node(NodePath("Sprite")));
+
+	// The connection made in ready is made again, not duplicated.
+	tree_root->add_child(reused);
+	CHECK(reused->ready_count == 2);
+	CHECK(reused->connect_error == OK);
+	reused->get_node(NodePath("Sprite"))->set_name("Renamed");
+	CHECK(reused->renamed_count == 1);
+
+	memdelete(reused);
+	memdelete(first);
+}
+
+TEST_CASE("[SceneTree][ScenePool] Release from a signal and after changing the scene") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_make_scene());
+
+	Window *tree_root = SceneTree::get_singleton()->get_root();
+	Node *bullet = pool->acquire();
+
+	// Released while the parent is busy adding it, where it can't be removed right away.
+	bullet->connect(SceneStringName(tree_entered), callable_mp(pool.ptr(), &ScenePool::release).bind(bullet), Object::CONNECT_ONE_SHOT);
+	tree_root->add_child(bullet);
+	CHECK(bullet->get_parent() == tree_root);
+	MessageQueue::get_singleton()->flush();
+	CHECK(bullet->get_parent() == nullptr);
+	CHECK(pool->get_available_count() == 1);
+
+	// Releasing twice is rejected.
+	ERR_PRINT_OFF;
+	pool->release(bullet);
+	ERR_PRINT_ON;
+	CHECK(pool->get_available_count() == 1);
+
+	Node *outside = pool->acquire();
+	Node *inside = pool->acquire();
+	tree_root->add_child(inside);
+	Node *pending = pool->acquire();
+	tree_root->add_child(pending);
+	pool->release(pending);
+
+	// Instances of the previous scene are freed when released, instead of being pooled.
+	pool->set_scene(_make_scene());
+	const ObjectID outside_id = outside->get_instance_id();
+	const ObjectID inside_id = inside->get_instance_id();
+	const ObjectID pending_id = pending->get_instance_id();
+	pool->release(outside);
+	pool->release(inside);
+	MessageQueue::get_singleton()->flush();
+	CHECK(pool->get_available_count() == 0);
+
+	SceneTree::get_singleton()->process(0); // Flush the deletion queue.
+	CHECK(ObjectDB::get_instance(outside_id) == nullptr);
+	CHECK(ObjectDB::get_instance(inside_id) == nullptr);
+	CHECK(ObjectDB::get_instance(pending_id) == nullptr);
+}
+
+} // namespace TestScenePool
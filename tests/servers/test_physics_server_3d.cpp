@@ -0,0 +1,230 @@
+/**************************************************************************/
+/*  test_physics_server_3d.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_physics_server_3d)
+
+#ifndef PHYSICS_3D_DISABLED
+
+#include "core/config/project_settings.h"
+#include "servers/physics_3d/physics_server_3d.h"
+
+namespace TestPhysicsServer3D {
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Batched queries match single queries") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	RID box = ps->box_shape_create();
+	ps->shape_set_data(box, Vector3(1, 1, 1));
+	RID body = ps->body_create();
+	ps->body_set_mode(body, PhysicsServer3D::BODY_MODE_STATIC);
+	ps->body_add_shape(body, box);
+	ps->body_set_space(body, space);
+
+	RID sphere = ps->sphere_shape_create();
+	ps->shape_set_data(sphere, 0.5);
+
+	PhysicsDirectSpaceState3D *state = ps->space_get_direct_state(space);
+	REQUIRE(state != nullptr);
+
+	// Enough queries to be spread across threads, half of them hitting the box.
+	const int count = 256;
+
+	LocalVector<Vector3> from;
+	LocalVector<Vector3> to;
+	LocalVector<Transform3D> transforms;
+	for (int i = 0; i < count; i++) {
+		const real_t x = -2.0 + 4.0 * (i + 0.5) / count;
+		from.push_back(Vector3(x, 5, 0));
+		to.push_back(Vector3(x, -5, 0));
+		transforms.push_back(Transform3D(Basis(), Vector3(x * 2.0, 0, 0)));
+	}
+
+	PhysicsDirectSpaceState3D::RayParameters ray_parameters;
+	LocalVector<PhysicsDirectSpaceState3D::RayResult> ray_results;
+	LocalVector<bool> hits;
+	ray_results.resize(count);
+	hits.resize(count);
+	state->intersect_rays(ray_parameters, from.ptr(), to.ptr(), count, ray_results.ptr(), hits.ptr());
+
+	int hit_count = 0;
+	for (int i = 0; i < count; i++) {
+		ray_parameters.from = from[i];
+		ray_parameters.to = to[i];
+		PhysicsDirectSpaceState3D::RayResult result;
+		const bool hit = state->intersect_ray(ray_parameters, result);
+		CHECK(hits[i] == hit);
+		if (hit && hits[i]) {
+			CHECK(ray_results[i].rid == body);
+			CHECK(ray_results[i].position.is_equal_approx(result.position));
+			CHECK(ray_results[i].normal.is_equal_approx(result.normal));
+			hit_count++;
+		}
+	}
+	CHECK(hit_count == count / 2);
+
+	PhysicsDirectSpaceState3D::ShapeParameters shape_parameters;
+	shape_parameters.shape_rid = sphere;
+	const int result_max = 4;
+	LocalVector<PhysicsDirectSpaceState3D::ShapeResult> shape_results;
+	LocalVector<int> result_counts;
+	shape_results.resize(count * result_max);
+	result_counts.resize(count);
+	state->intersect_shapes(shape_parameters, transforms.ptr(), count, shape_results.ptr(), result_max, result_counts.ptr());
+
+	int shape_hit_count = 0;
+	for (int i = 0; i < count; i++) {
+		shape_parameters.transform = transforms[i];
+		PhysicsDirectSpaceState3D::ShapeResult results[result_max];
+		const int result_count = state->intersect_shape(shape_parameters, results, result_max);
+		CHECK(result_counts[i] == result_count);
+		if (result_counts[i] == 1 && result_count == 1) {
+			CHECK(shape_results[i * result_max].rid == body);
+			shape_hit_count++;
+		}
+	}
+	CHECK(shape_hit_count > 0);
+	CHECK(shape_hit_count < count);
+
+	ps->free_rid(body);
+	ps->free_rid(sphere);
+	ps->free_rid(box);
+	ps->free_rid(space);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Space state hash") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+
+	RID box = ps->box_shape_create();
+	ps->shape_set_data(box, Vector3(1, 1, 1));
+
+	RID spaces[2];
+	RID bodies[2][2];
+	for (int i = 0; i < 2; i++) {
+		spaces[i] = ps->space_create();
+		ps->space_set_active(spaces[i], true);
+
+		// Bodies are added in a different order in each space.
+		for (int j = 0; j < 2; j++) {
+			RID body = ps->body_create();
+			ps->body_add_shape(body, box);
+			ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(i == 0 ? j * 4 : 4 - j * 4, 0, 0)));
+			ps->body_set_space(body, spaces[i]);
+			bodies[i][j] = body;
+		}
+	}
+
+	CHECK(ps->space_get_state_hash(spaces[0]) == ps->space_get_state_hash(spaces[1]));
+
+	// Areas aren't part of the simulated state.
+	RID area = ps->area_create();
+	ps->area_add_shape(area, box);
+	ps->area_set_transform(area, Transform3D(Basis(), Vector3(2, 0, 0)));
+	ps->area_set_space(area, spaces[0]);
+	CHECK(ps->space_get_state_hash(spaces[0]) == ps->space_get_state_hash(spaces[1]));
+
+	ps->body_set_state(bodies[1][0], PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(0, 1, 0));
+	CHECK(ps->space_get_state_hash(spaces[0]) != ps->space_get_state_hash(spaces[1]));
+
+	ps->free_rid(area);
+	for (int i = 0; i < 2; i++) {
+		ps->free_rid(bodies[i][0]);
+		ps->free_rid(bodies[i][1]);
+		ps->free_rid(spaces[i]);
+	}
+	ps->free_rid(box);
+}
+
+static Vector<uint64_t> _step_box_stack(int p_steps) {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	RID box = ps->box_shape_create();
+	ps->shape_set_data(box, Vector3(0.5, 0.5, 0.5));
+	RID floor_shape = ps->box_shape_create();
+	ps->shape_set_data(floor_shape, Vector3(10, 0.5, 10));
+
+	RID floor = ps->body_create();
+	ps->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	ps->body_add_shape(floor, floor_shape);
+	ps->body_set_space(floor, space);
+
+	// A slightly offset and rotated stack, so bodies collide with several others and tumble.
+	Vector<RID> bodies;
+	for (int i = 0; i < 8; i++) {
+		RID body = ps->body_create();
+		ps->body_add_shape(body, box);
+		ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(Vector3(0, 1, 0), i * 0.2), Vector3(i * 0.1, 1 + i * 1.1, 0)));
+		ps->body_set_space(body, space);
+		bodies.push_back(body);
+	}
+
+	Vector<uint64_t> hashes;
+	for (int i = 0; i < p_steps; i++) {
+		ps->step(1.0 / 60.0);
+		ps->flush_queries();
+		hashes.push_back(ps->space_get_state_hash(space));
+	}
+
+	for (const RID &body : bodies) {
+		ps->free_rid(body);
+	}
+	ps->free_rid(floor);
+	ps->free_rid(floor_shape);
+	ps->free_rid(box);
+	ps->free_rid(space);
+
+	return hashes;
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Deterministic simulation gives the same state hashes") {
+	// The setting is read when spaces are created.
+	ProjectSettings::get_singleton()->set_setting("physics/3d/solver/deterministic_simulation", true);
+
+	const Vector<uint64_t> first = _step_box_stack(120);
+	const Vector<uint64_t> second = _step_box_stack(120);
+
+	ProjectSettings::get_singleton()->set_setting("physics/3d/solver/deterministic_simulation", false);
+
+	REQUIRE(first.size() == second.size());
+	for (int i = 0; i < first.size(); i++) {
+		CHECK_MESSAGE(first[i] == second[i], vformat("State hashes differ after step %d.", i + 1));
+	}
+}
+
+} // namespace TestPhysicsServer3D
+
+#endif // PHYSICS_3D_DISABLED